@@ -8,6 +8,8 @@
  */
 #pragma once
 
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include <H5Apublic.h>
@@ -286,6 +288,94 @@ class Attribute: public Object, public PathTraits<Attribute> {
     friend Attribute detail::make_attribute(hid_t);
 };
 
+class AttributeValue;
+
+namespace detail {
+AttributeValue read_attribute_value(const Attribute& attribute);
+const void* attribute_value_data(const AttributeValue& value, std::vector<const char*>& strings);
+}  // namespace detail
+
+///
+/// \brief The value of an attribute of one of the common types.
+///
+/// Holds integers, floating point numbers or strings, either a scalar or an
+/// array of any rank. Values are widened to `int64_t`, `uint64_t`, `double`
+/// or `std::string` respectively. Attributes of other types, e.g. compound or
+/// enum types, have `Kind::Other` and only their datatype and dimensions are
+/// retrieved.
+///
+/// \code{.cpp}
+/// auto attributes = dset.readAllAttributes();
+/// auto unit = attributes.at("unit").get<std::string>();
+/// auto origin = attributes.at("origin").get<std::vector<double>>();
+/// \endcode
+///
+/// \sa AnnotateTraits::readAllAttributes, AnnotateTraits::createAttributes
+/// \since 3.0
+class AttributeValue {
+  public:
+    enum class Kind { Integer, Unsigned, Float, String, Other };
+
+    AttributeValue() = default;
+
+    /// \brief A scalar number, `bool` isn't supported.
+    template <typename T,
+              typename = typename std::enable_if<std::is_arithmetic<T>::value &&
+                                                 !std::is_same<T, bool>::value>::type>
+    AttributeValue(T value);
+
+    /// \brief A scalar string.
+    AttributeValue(const char* value);
+
+    /// \brief A scalar string.
+    AttributeValue(std::string value);
+
+    /// \brief A one-dimensional array of numbers.
+    template <typename T>
+    AttributeValue(const std::vector<T>& values);
+
+    /// \brief A one-dimensional array of strings.
+    AttributeValue(std::vector<std::string> values);
+
+    Kind getKind() const noexcept;
+
+    /// \brief The dimensions, empty for scalars.
+    const std::vector<size_t>& getDimensions() const noexcept;
+
+    /// \brief The datatype of the attribute, only set when read from a file.
+    const DataType& getDataType() const noexcept;
+
+    ///
+    /// \brief Convert the value to `T`.
+    ///
+    /// `T` is either a number, `std::string` or a `std::vector` of either.
+    /// Scalars require exactly one element, arrays of any rank are flattened
+    /// in row-major order. Numbers are converted with `static_cast`, strings
+    /// can't be converted to numbers or vice versa.
+    template <typename T>
+    T get() const;
+
+  private:
+    template <typename T>
+    void _get(T& value) const;
+    void _get(std::string& value) const;
+    template <typename T>
+    void _get(std::vector<T>& values) const;
+    void _get(std::vector<std::string>& values) const;
+
+    Kind _kind = Kind::Other;
+    std::vector<size_t> _dims;
+    std::vector<int64_t> _integers;
+    std::vector<uint64_t> _unsigned;
+    std::vector<double> _floats;
+    std::vector<std::string> _strings;
+    DataType _datatype;
+
+    friend AttributeValue detail::read_attribute_value(const Attribute& attribute);
+    friend const void* detail::attribute_value_data(const AttributeValue& value,
+                                                    std::vector<const char*>& strings);
+};
+
 namespace detail {
 inline Attribute make_attribute(hid_t hid) {
     return Attribute(hid);
@@ -0,0 +1,117 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "H5Exception.hpp"
+#include "bits/H5Instrumentation.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A timeline of the I/O done by HighFive, in the Chrome trace format.
+///
+/// Records reads and writes, the creation of datasets and attributes, flushes
+/// and the conversion of data between containers and HDF5 buffers. Every event
+/// is tagged with the path of the object, the number of elements and the
+/// number of bytes. The JSON written by `write` can be viewed in Perfetto or
+/// `chrome://tracing`.
+///
+/// The trace receives the records of the instrumentation, hence HighFive must
+/// be compiled with `HIGHFIVE_ENABLE_INSTRUMENTATION` defined:
+///
+/// \code{.cpp}
+/// ChromeTrace trace(mpi_rank);
+/// register_instrumentation_callback(
+///     [&trace](const InstrumentationRecord& record) { trace.record(record); });
+///
+/// // ... HighFive I/O, on any number of threads ...
+///
+/// register_instrumentation_callback(nullptr);
+/// trace.write("trace.json");
+/// \endcode
+///
+/// Timestamps are measured from the Unix epoch, according to the system clock,
+/// such that the traces of several processes, and of machines with synchronized
+/// clocks, line up.
+///
+/// Thread-safe.
+///
+/// \since 3.0
+class ChromeTrace {
+  public:
+    ///
+    /// \brief Create an empty trace.
+    ///
+    /// \param process_id The process the events are attributed to, e.g. the
+    ///     MPI rank. Traces of several processes can be viewed side by side.
+    explicit ChromeTrace(int process_id = 0);
+
+    ///
+    /// \brief Add the event of `record`, unless it's not part of the timeline.
+    ///
+    void record(const InstrumentationRecord& record);
+
+    ///
+    /// \brief Number of events recorded.
+    ///
+    size_t size() const;
+
+    ///
+    /// \brief Remove all events.
+    ///
+    void clear();
+
+    ///
+    /// \brief Write the trace as JSON into `os`.
+    ///
+    void write(std::ostream& os) const;
+
+    ///
+    /// \brief Write the trace as JSON into the file `filename`.
+    ///
+    void write(const std::string& filename) const;
+
+  private:
+    struct Event {
+        const char* name;
+        const char* category;
+        std::string path;
+        std::chrono::nanoseconds start;
+        std::chrono::nanoseconds duration;
+        size_t thread;
+        size_t elements;
+        size_t bytes;
+    };
+
+    static const char* getCategory(const char* function);
+
+    int _process_id;
+
+    // The records are timed by the steady clock. Its time at `_origin`
+    // corresponds to `_epoch_offset` since the Unix epoch.
+    std::chrono::steady_clock::time_point _origin;
+    std::chrono::nanoseconds _epoch_offset;
+
+    mutable std::mutex _mutex;
+    std::vector<Event> _events;
+    std::map<std::thread::id, size_t> _threads;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5ChromeTrace_misc.hpp"
@@ -21,6 +21,21 @@
 
 namespace HighFive {
 
+///
+/// \brief Location and size of an allocated chunk of a dataset.
+///
+/// \sa DataSet::listAllocatedChunks
+struct ChunkInfo {
+    /// Logical coordinates of the first element of the chunk.
+    std::vector<size_t> offset;
+    /// Bitmask of the filters that were skipped when writing the chunk.
+    unsigned filter_mask = 0;
+    /// Address of the chunk in the file.
+    uint64_t address = 0;
+    /// Number of bytes the chunk occupies in the file.
+    uint64_t size = 0;
+};
+
 ///
 /// \brief Class representing a dataset.
 ///
@@ -88,6 +103,68 @@ class DataSet: public Object,
         return getSpace().getElementCount();
     }
 
+    ///
+    /// \brief Number of chunks for which storage has been allocated.
+    ///
+    /// Chunks that were never written, and are not allocated early, don't
+    /// occupy any storage. Requires a chunked dataset and HDF5 1.10.5 or newer.
+    ///
+    /// \since 3.0
+    size_t getNumberAllocatedChunks() const;
+
+    ///
+    /// \brief List all chunks for which storage has been allocated.
+    ///
+    /// The information is retrieved from the chunk index without reading any
+    /// raw data. Requires a chunked dataset and HDF5 1.10.5 or newer.
+    ///
+    /// With HDF5 1.12.3 or newer the chunk index is traversed once. Older
+    /// versions look up every chunk separately, which takes time quadratic in
+    /// the number of allocated chunks.
+    ///
+    /// \since 3.0
+    std::vector<ChunkInfo> listAllocatedChunks() const;
+
+    ///
+    /// \brief The region of the dataset which is backed by allocated storage.
+    ///
+    /// For chunked datasets this is the union of all allocated chunks, clipped
+    /// to the current extent of the dataset. For other layouts it is either the
+    /// entire dataset or nothing, depending on whether storage has been
+    /// allocated.
+    ///
+    /// Before HDF5 1.12.3, listing the chunks is quadratic in their number.
+    /// Therefore, if more than 4096 chunks are allocated, the region is the
+    /// entire dataset, which contains the allocated chunks.
+    ///
+    /// \since 3.0
+    HyperSlab getAllocatedRegion() const;
+
+    ///
+    /// \brief Read the entire dataset, skipping chunks that aren't allocated.
+    ///
+    /// Produces the same result as `read`. However, the buffer is first set to
+    /// the fill value and then only the allocated chunks are read. For sparse
+    /// datasets this avoids asking HDF5 to visit every chunk of the dataset.
+    ///
+    /// Datasets which aren't chunked, have no defined fill value or need
+    /// variable length memory, e.g. strings, are read with `read`. So are
+    /// datasets whose chunks are too many to be listed, see
+    /// `getAllocatedRegion`.
+    ///
+    /// \since 3.0
+    template <typename T>
+    void readSparse(T& array, const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// \brief Read the entire dataset, skipping chunks that aren't allocated.
+    ///
+    /// \sa readSparse(T&, const DataTransferProps&)
+    ///
+    /// \since 3.0
+    template <typename T>
+    T readSparse(const DataTransferProps& xfer_props = DataTransferProps()) const;
+
     /// \brief Get the list of properties for creation of this dataset
     DataSetCreateProps getCreatePropertyList() const {
         return details::get_plist<DataSetCreateProps>(*this, H5Dget_create_plist);
@@ -98,6 +175,18 @@ class DataSet: public Object,
         return details::get_plist<DataSetAccessProps>(*this, H5Dget_access_plist);
     }
 
+    ///
+    /// \brief The configuration of the chunk cache of this dataset.
+    ///
+    /// Only meaningful for chunked datasets. HDF5 doesn't allow changing the
+    /// chunk cache of an open dataset. Instead, open the dataset again with a
+    /// `Caching` in its access properties.
+    ///
+    /// \since 3.0
+    Caching getChunkCache() const {
+        return Caching(getAccessPropertyList());
+    }
+
     DataSet() = default;
 
   protected:
@@ -109,6 +198,8 @@ class DataSet: public Object,
     friend class Reference;
     template <typename Derivate>
     friend class NodeTraits;
+    template <typename Derivate>
+    friend class CreationContext;
 };
 
 }  // namespace HighFive
@@ -117,6 +117,7 @@ class DataType: public Object {
     friend class File;
     friend class DataSet;
     friend class CompoundType;
+    friend class StructureIndex;
     template <typename Derivate>
     friend class NodeTraits;
 };
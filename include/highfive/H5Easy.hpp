@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -87,6 +88,13 @@ enum class Flush {
     True = 1   /*!< Automatic flushing. */
 };
 
+///
+/// \brief Signal how extendible DataSets grow when written beyond their shape.
+enum class Growth {
+    Exact = 0,    /*!< Grow to the largest index written. */
+    Geometric = 1 /*!< Grow to at least double the shape, fewer resizes. */
+};
+
 ///
 /// \brief Signal to set compression level for written DataSets.
 class Compression {
@@ -121,6 +129,7 @@ class Compression {
 /// - Flush::True
 /// - Compression: false
 /// - ChunkSize: automatic
+/// - Growth::Exact
 class DumpOptions {
   public:
     ///
@@ -150,6 +159,17 @@ class DumpOptions {
     /// \param level Compression.
     inline void set(const Compression& level);
 
+    ///
+    /// \brief Overwrite H5Easy::Growth setting.
+    ///
+    /// With Growth::Geometric, dumping to an index beyond the shape of an
+    /// extendible DataSet at least doubles the extent of every dimension that
+    /// grows. Hence, the DataSet can be larger than the largest index written,
+    /// the remaining entries hold the fill value.
+    ///
+    /// \param mode Growth.
+    inline void set(Growth mode);
+
     ///
     /// \brief Overwrite any setting(s).
     /// \param arg any of DumpMode(), Flush(), Compression in arbitrary number and order.
@@ -183,6 +203,11 @@ class DumpOptions {
     /// \return bool
     inline bool compress() const;
 
+    ///
+    /// \brief Get growth-mode.
+    /// \return ``true`` for Growth::Geometric
+    inline bool growGeometrically() const;
+
     ///
     /// \brief Get compression level.
     /// \return [0..9]
@@ -202,6 +227,7 @@ class DumpOptions {
   private:
     bool m_overwrite = false;
     bool m_flush = true;
+    bool m_geometric_growth = false;
     unsigned m_compression_level = 0;
     std::vector<hsize_t> m_chunk_size = {};
 };
@@ -333,6 +359,45 @@ inline DataSet dump(File& file,
 template <class T>
 inline T load(const File& file, const std::string& path, const std::vector<size_t>& idx);
 
+///
+/// \brief Write scalars to entries ``{i, j, ...}`` of a (new, extendible) DataSet in an open HDF5
+/// file.
+///
+/// Unlike calling H5Easy::dump once per index, the DataSet is opened and resized at most once,
+/// and all values are written with a single selection. If `indices` is empty nothing is written,
+/// and the DataSet must exist already, since its rank can't be deduced; otherwise this throws.
+///
+/// \param file opened file (has to be writeable)
+/// \param path path of the DataSet
+/// \param data the values to write, one per index
+/// \param indices the indices to which to write
+/// \param options dump options
+///
+/// \return The newly created DataSet
+///
+template <class T>
+inline DataSet dumpBatch(File& file,
+                         const std::string& path,
+                         const std::vector<T>& data,
+                         const std::vector<std::vector<size_t>>& indices,
+                         const DumpOptions& options = DumpOptions());
+
+///
+/// \brief Load entries ``{i, j, ...}`` from a DataSet in an open HDF5 file.
+///
+/// All entries are read with a single selection.
+///
+/// \param file opened file (has to be readable)
+/// \param path path of the DataSet
+/// \param indices the indices to load
+///
+/// \return The read data, one value per index
+///
+template <class T>
+inline std::vector<T> loadBatch(const File& file,
+                                const std::string& path,
+                                const std::vector<std::vector<size_t>>& indices);
+
 ///
 /// \brief Load a DataSet in an open HDF5 file to an object (templated).
 ///
@@ -392,9 +457,149 @@ inline Attribute dumpAttribute(File& file,
 template <class T>
 inline T loadAttribute(const File& file, const std::string& path, const std::string& key);
 
+///
+/// \brief Cache of opened DataSets and Attributes for repeated dump/load.
+///
+/// Each call to H5Easy::dump or H5Easy::load checks if the path exists, what
+/// kind of object it refers to and then opens it. A Session does this only the
+/// first time a path is used. Afterwards, the cached handle and shape are
+/// reused and a repeated dump/load is a single write/read.
+///
+/// The cache only knows about changes made through the Session. Use
+/// Session::unlink and Session::rename, or call Session::invalidate after
+/// modifying the file by other means.
+class Session {
+  public:
+    ///
+    /// \brief Start a session on an opened file.
+    /// \param file opened file
+    explicit Session(const File& file);
+
+    ///
+    /// \brief The file of this session.
+    inline File& getFile();
+
+    ///
+    /// \brief Write object (templated) to a (new) DataSet, see H5Easy::dump.
+    ///
+    /// \param path path of the DataSet
+    /// \param data the data to write (any supported type)
+    /// \param mode write mode
+    ///
+    /// \return The (cached) DataSet
+    template <class T>
+    inline DataSet dump(const std::string& path,
+                        const T& data,
+                        DumpMode mode = DumpMode::Create);
+
+    ///
+    /// \brief Write object (templated) to a (new) DataSet, see H5Easy::dump.
+    ///
+    /// \param path path of the DataSet
+    /// \param data the data to write (any supported type)
+    /// \param options dump options
+    ///
+    /// \return The (cached) DataSet
+    template <class T>
+    inline DataSet dump(const std::string& path, const T& data, const DumpOptions& options);
+
+    ///
+    /// \brief Load a DataSet to an object (templated), see H5Easy::load.
+    ///
+    /// \param path path of the DataSet
+    ///
+    /// \return The read data
+    template <class T>
+    inline T load(const std::string& path);
+
+    ///
+    /// \brief Write object (templated) to a (new) Attribute, see H5Easy::dumpAttribute.
+    ///
+    /// \param path path of the DataSet
+    /// \param key name of the attribute
+    /// \param data the data to write (any supported type)
+    /// \param mode write mode
+    ///
+    /// \return The (cached) Attribute
+    template <class T>
+    inline Attribute dumpAttribute(const std::string& path,
+                                   const std::string& key,
+                                   const T& data,
+                                   DumpMode mode = DumpMode::Create);
+
+    ///
+    /// \brief Write object (templated) to a (new) Attribute, see H5Easy::dumpAttribute.
+    ///
+    /// \param path path of the DataSet
+    /// \param key name of the attribute
+    /// \param data the data to write (any supported type)
+    /// \param options dump options
+    ///
+    /// \return The (cached) Attribute
+    template <class T>
+    inline Attribute dumpAttribute(const std::string& path,
+                                   const std::string& key,
+                                   const T& data,
+                                   const DumpOptions& options);
+
+    ///
+    /// \brief Load an Attribute to an object (templated), see H5Easy::loadAttribute.
+    ///
+    /// \param path path of the DataSet
+    /// \param key name of the attribute
+    ///
+    /// \return The read data
+    template <class T>
+    inline T loadAttribute(const std::string& path, const std::string& key);
+
+    ///
+    /// \brief Get the (cached) shape of an existing DataSet.
+    inline std::vector<size_t> getShape(const std::string& path);
+
+    ///
+    /// \brief Get the (cached) size of an existing DataSet.
+    inline size_t getSize(const std::string& path);
+
+    ///
+    /// \brief Unlink `path` and drop it, and everything below it, from the cache.
+    inline void unlink(const std::string& path);
+
+    ///
+    /// \brief Rename `src_path` and drop both paths from the cache.
+    /// \return true if the move was successful
+    inline bool rename(const std::string& src_path, const std::string& dest_path);
+
+    ///
+    /// \brief Drop `path`, and everything below it, from the cache.
+    inline void invalidate(const std::string& path);
+
+    ///
+    /// \brief Drop all cached handles.
+    inline void clear();
+
+  private:
+    struct CachedAttribute {
+        Attribute attribute;
+        std::vector<size_t> shape;
+    };
+
+    struct CachedDataSet {
+        DataSet dataset;
+        std::vector<size_t> shape;
+        std::map<std::string, CachedAttribute> attributes;
+    };
+
+    inline static std::string normalize(const std::string& path);
+    inline CachedDataSet& getCached(const std::string& path);
+
+    File m_file;
+    std::map<std::string, CachedDataSet> m_cache;
+};
+
 }  // namespace H5Easy
 
 #include "h5easy_bits/H5Easy_Eigen.hpp"
 #include "h5easy_bits/H5Easy_misc.hpp"
 #include "h5easy_bits/H5Easy_public.hpp"
 #include "h5easy_bits/H5Easy_scalar.hpp"
+#include "h5easy_bits/H5Easy_session.hpp"
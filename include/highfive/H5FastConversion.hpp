@@ -0,0 +1,95 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include "H5DataSet.hpp"
+#include "H5File.hpp"
+#include "bits/H5Simd.hpp"
+
+namespace HighFive {
+
+///
+/// \brief The `SimdLevel` used by the registered fast conversions.
+///
+/// \since 3.0
+SimdLevel get_fast_conversion_simd_level();
+
+///
+/// \brief Register vectorized conversions for common numeric pairs with HDF5.
+///
+/// HDF5 converts between types element by element, e.g. when reading `int16`
+/// or big-endian `float` datasets into `std::vector<double>`, or `double`
+/// datasets into `float`. This registers hard conversion functions, via
+/// `H5Tregister`, which convert blocks of elements using SSE2, AVX2 or
+/// AVX-512, selected at runtime. The following pairs are covered:
+///
+///   * `int16`, `int32` and `float` to `double`, and `double` to `float`;
+///   * big-endian `int16`, `int32`, `float` to `double`, and big-endian
+///     `double` to `float`;
+///   * `double` to big-endian `float`;
+///   * big-endian to native and native to big-endian for 16, 32 and 64-bit
+///     integers, `float` and `double`;
+///   * half precision floats, see `half_float.hpp`, to `float` and back;
+///   * `bfloat16_t`, see `bfloat16.hpp`, to `float` and back.
+///
+/// Conversions from big-endian types are only registered on little-endian
+/// hosts. The results are identical to HDF5's conversions between native
+/// types, including overflow to infinity and the exception callback set with
+/// `H5Pset_type_conv_cb`. HDF5 converts big-endian `double` to `float` in
+/// software, which rounds some subnormal values and values just above
+/// `FLT_MAX` differently; the fast conversions round as for native types.
+///
+/// Half precision floats are converted with F16C, if the CPU supports it in
+/// addition to AVX2, or with AVX-512; otherwise in scalar code. Unlike HDF5's soft conversion, subnormal
+/// values are rounded to nearest and NaN payloads are preserved, as by
+/// `half_float::half`. Conversions to `bfloat16_t` round like its constructor
+/// and only need SSE2; AVX512_BF16 isn't used since it flushes subnormal
+/// values to zero. Reading half precision or `bfloat16_t` datasets into
+/// `float` with `read` skips HDF5's conversion altogether: the raw data is
+/// read into the front of the buffer and widened in place. `read_raw` uses the
+/// registered conversions.
+///
+/// The conversions are registered for the whole process and replace the
+/// built-in ones for the same pairs, until the library is closed. HighFive
+/// has no initialization hook, therefore call this once, e.g. at the
+/// beginning of `main` and before any concurrent I/O:
+///
+/// \code{.cpp}
+/// int main() {
+///     HighFive::register_fast_conversions();
+///     // ...
+/// }
+/// \endcode
+///
+/// Calling it again only changes the `SimdLevel`.
+///
+/// \param level The instruction set to use, limited to what the CPU supports.
+///
+/// \since 3.0
+void register_fast_conversions(SimdLevel level = get_supported_simd_level());
+
+///
+/// \brief Unregister the conversions registered by `register_fast_conversions`.
+///
+/// This doesn't restore HDF5's default behaviour: `H5Tunregister` can't bring
+/// back the built-in hard conversions which the fast ones replaced. The pairs
+/// which had one, e.g. `int16` to `double` or `double` to `float`, are
+/// converted by HDF5's slower soft conversions instead, which may round
+/// differently. Only a new process converts like HDF5 does by default.
+///
+/// Like registering, this affects the whole process and mustn't be called
+/// concurrently with any I/O. Does nothing if the conversions aren't
+/// registered.
+///
+/// \since 3.0
+void unregister_fast_conversions();
+
+}  // namespace HighFive
+
+#include "bits/H5FastConversion_misc.hpp"
@@ -18,6 +18,54 @@
 
 namespace HighFive {
 
+///
+/// \brief The size of the metadata cache of a file, in bytes.
+///
+/// \sa File::getMetadataCacheSize
+///
+/// \since 3.0
+struct MetadataCacheSize {
+    /// The size above which the cache doesn't grow.
+    size_t max_size = 0;
+    /// The amount of clean entries the cache tries to keep.
+    size_t min_clean_size = 0;
+    /// The size of the entries currently in the cache.
+    size_t current_size = 0;
+    /// The number of entries currently in the cache.
+    size_t n_entries = 0;
+};
+
+#if H5_VERSION_GE(1, 10, 1)
+///
+/// \brief Counters of the page buffer for either metadata or raw data.
+///
+/// \since 3.0
+struct PageBufferCounters {
+    unsigned accesses = 0;
+    unsigned hits = 0;
+    unsigned misses = 0;
+    unsigned evictions = 0;
+    /// Accesses which didn't go through the page buffer, e.g. because they
+    /// were larger than a page.
+    unsigned bypasses = 0;
+
+    /// \brief The fraction of accesses which were hits, or `0` if there were none.
+    double getHitRate() const {
+        return accesses == 0 ? 0.0 : double(hits) / double(accesses);
+    }
+};
+
+///
+/// \brief The statistics of the page buffer of a file.
+///
+/// \sa File::getPageBufferStatistics
+///
+/// \since 3.0
+struct PageBufferStatistics {
+    PageBufferCounters metadata;
+    PageBufferCounters raw_data;
+};
+#endif
 
 ///
 /// \brief File class
@@ -111,6 +159,60 @@ class File: public Object, public NodeTraits<File>, public AnnotateTraits<File>
     ///
     void flush();
 
+    ///
+    /// \brief The fraction of accesses to the metadata cache which were hits.
+    ///
+    /// Counted since the file was opened or the last call to
+    /// `resetMetadataCacheHitRate`.
+    ///
+    /// \since 3.0
+    double getMetadataCacheHitRate() const;
+
+    ///
+    /// \brief Reset the counters of `getMetadataCacheHitRate`.
+    ///
+    /// \since 3.0
+    void resetMetadataCacheHitRate();
+
+    ///
+    /// \brief The current size of the metadata cache.
+    ///
+    /// \since 3.0
+    MetadataCacheSize getMetadataCacheSize() const;
+
+    ///
+    /// \brief The current configuration of the metadata cache.
+    ///
+    /// \since 3.0
+    MetadataCacheConfig getMetadataCacheConfig() const;
+
+    ///
+    /// \brief Reconfigure the metadata cache of the open file.
+    ///
+    /// Unless `set_initial_size` is set in the configuration, the cache keeps
+    /// its current size.
+    ///
+    /// \since 3.0
+    void setMetadataCacheConfig(const MetadataCacheConfig& config);
+
+#if H5_VERSION_GE(1, 10, 1)
+    ///
+    /// \brief The statistics of the page buffer.
+    ///
+    /// Counted since the file was opened or the last call to
+    /// `resetPageBufferStatistics`. Requires that the file was opened with a
+    /// `PageBufferSize`.
+    ///
+    /// \since 3.0
+    PageBufferStatistics getPageBufferStatistics() const;
+
+    ///
+    /// \brief Reset the statistics of the page buffer.
+    ///
+    /// \since 3.0
+    void resetPageBufferStatistics();
+#endif
+
     /// \brief Get the list of properties for creation of this file
     FileCreateProps getCreatePropertyList() const {
         return details::get_plist<FileCreateProps>(*this, H5Fget_create_plist);
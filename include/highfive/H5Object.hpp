@@ -83,6 +83,9 @@ class Object {
     // Copy-Assignment operator
     Object& operator=(const Object& other);
 
+    // Move-Assignment operator, reuse hid
+    Object& operator=(Object&& other) noexcept;
+
     hid_t _hid;
 
   private:
@@ -0,0 +1,207 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5DataType.hpp"
+#include "H5PropertyList.hpp"
+#include "bits/H5Inspector_decl.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A sequence of bits, packed eight per byte.
+///
+/// `std::vector<bool>` is stored like h5py stores booleans: as an enum with
+/// one byte per element. `PackedBits` instead stores the bits as an 8-bit
+/// bitfield, `H5T_NATIVE_B8`, i.e. eight times smaller, which suits large
+/// masks. Bit `i` is the bit `i % 8`, counting from the least significant
+/// bit, of the byte `i / 8`; NumPy calls this the little bit order, see
+/// `numpy.unpackbits`.
+///
+/// \code{.cpp}
+/// std::vector<bool> mask = ...;
+/// file.createDataSet("mask", PackedBits(mask));
+///
+/// auto mask = file.getDataSet("mask").read<PackedBits>().toVector();
+/// \endcode
+///
+/// The dataset is one-dimensional with one element per byte; the unused bits of
+/// the last byte are zero. The dataset doesn't know the number of bits, hence
+/// `read<PackedBits>()` rounds it up to a multiple of eight, use `resize` to
+/// restore it. `PackedBits::create` additionally stores the number of bits in
+/// the attribute `highfive_bit_count`, which `PackedBits::read` uses:
+///
+/// \code{.cpp}
+/// PackedBits::create(file, "mask", PackedBits(mask));
+/// auto mask = PackedBits::read(file.getDataSet("mask")).toVector();
+/// \endcode
+///
+/// Selections select bytes, i.e. blocks of eight bits.
+///
+/// Packing and unpacking is vectorized. `std::vector<bool>` is copied through
+/// a buffer of bytes, since its bits are only accessible one at a time.
+///
+/// \since 3.0
+class PackedBits {
+  public:
+    PackedBits() = default;
+
+    /// \brief `n_bits` bits, all set to `value`.
+    explicit PackedBits(size_t n_bits, bool value = false);
+
+    /// \brief Pack `values`.
+    explicit PackedBits(const std::vector<bool>& values);
+
+    /// \brief Pack the `n_bits` booleans starting at `values`.
+    PackedBits(const bool* values, size_t n_bits);
+
+    /// \brief Create the dataset `name` in `node` holding `bits`.
+    ///
+    /// The number of bits is stored in the attribute `highfive_bit_count`.
+    template <class Node>
+    static DataSet create(
+        Node& node,
+        const std::string& name,
+        const PackedBits& bits,
+        const DataSetCreateProps& create_props = DataSetCreateProps::Default());
+
+    /// \brief Read all bits of `dataset`.
+    ///
+    /// If the dataset has the attribute `highfive_bit_count` the result has
+    /// that many bits, otherwise a multiple of eight.
+    static PackedBits read(const DataSet& dataset,
+                           const DataTransferProps& xfer_props = DataTransferProps());
+
+    /// \brief The number of bits.
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    /// \brief The number of bytes needed for the bits.
+    size_t getByteSize() const noexcept {
+        return _bytes.size();
+    }
+
+    /// \brief Change the number of bits, new bits are zero.
+    void resize(size_t n_bits);
+
+    /// \brief The value of bit `i`.
+    bool operator[](size_t i) const {
+        return ((_bytes[i / 8] >> (i % 8)) & 1u) != 0;
+    }
+
+    /// \brief Set bit `i` to `value`.
+    void set(size_t i, bool value = true);
+
+    /// \brief The number of bits which are set.
+    size_t count() const noexcept;
+
+    /// \brief Unpack the bits into a `std::vector<bool>`.
+    std::vector<bool> toVector() const;
+
+    /// \brief Unpack the bits into the `size()` booleans starting at `values`.
+    void unpack(bool* values) const;
+
+    /// \brief The packed bytes.
+    uint8_t* data() noexcept {
+        return _bytes.data();
+    }
+
+    /// \brief The packed bytes.
+    const uint8_t* data() const noexcept {
+        return _bytes.data();
+    }
+
+    bool operator==(const PackedBits& other) const {
+        return _size == other._size && _bytes == other._bytes;
+    }
+
+    bool operator!=(const PackedBits& other) const {
+        return !(*this == other);
+    }
+
+  private:
+    void clearUnusedBits();
+
+    std::vector<uint8_t> _bytes;
+    size_t _size = 0;
+};
+
+namespace details {
+
+// The element of a `PackedBits` dataset.
+struct packed_bits_byte {
+    uint8_t bits;
+};
+
+template <>
+struct inspector<PackedBits> {
+    using type = PackedBits;
+    using value_type = packed_bits_byte;
+    using base_type = packed_bits_byte;
+    using hdf5_type = uint8_t;
+
+    static constexpr size_t ndim = 1;
+    static constexpr size_t min_ndim = ndim;
+    static constexpr size_t max_ndim = ndim;
+
+    static constexpr bool is_trivially_copyable = true;
+    static constexpr bool is_trivially_nestable = false;
+
+    static size_t getRank(const type& /* val */) {
+        return ndim;
+    }
+
+    static std::vector<size_t> getDimensions(const type& val) {
+        return {val.getByteSize()};
+    }
+
+    static void prepare(type& val, const std::vector<size_t>& dims) {
+        if (dims.size() > 1) {
+            throw DataSpaceException("PackedBits is only 1 dimension.");
+        }
+        val.resize(8 * dims[0]);
+    }
+
+    static hdf5_type* data(type& val) {
+        return val.data();
+    }
+
+    static const hdf5_type* data(const type& val) {
+        return val.data();
+    }
+
+    static void serialize(const type& val, const std::vector<size_t>& /* dims */, hdf5_type* m) {
+        std::copy(val.data(), val.data() + val.getByteSize(), m);
+    }
+
+    static void unserialize(const hdf5_type* vec_align,
+                            const std::vector<size_t>& dims,
+                            type& val) {
+        std::copy(vec_align, vec_align + dims[0], val.data());
+    }
+};
+
+}  // namespace details
+
+template <>
+inline AtomicType<details::packed_bits_byte>::AtomicType() {
+    _hid = detail::h5t_copy(H5T_NATIVE_B8);
+}
+
+}  // namespace HighFive
+
+#include "bits/H5PackedBits_misc.hpp"
@@ -8,6 +8,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <vector>
 
 #include <H5Ppublic.h>
@@ -368,6 +369,44 @@ class MetadataBlockSize {
     hsize_t _size;
 };
 
+///
+/// \brief Configure the metadata cache of a file.
+///
+/// The cache resizes itself between a minimum and maximum size, depending on
+/// its hit rate. The remaining parameters of the cache can be set through the
+/// `H5AC_cache_config_t`, see the upstream documentation of
+/// `H5Pset_mdc_config`.
+///
+/// \sa File::getMetadataCacheHitRate, File::setMetadataCacheConfig
+///
+/// \since 3.0
+class MetadataCacheConfig {
+  public:
+    ///
+    /// \brief The default configuration with the given sizes, in bytes.
+    ///
+    /// \param initial_size The size of the cache when the file is opened.
+    /// \param min_size The size below which the cache doesn't shrink.
+    /// \param max_size The size above which the cache doesn't grow.
+    MetadataCacheConfig(size_t initial_size, size_t min_size, size_t max_size);
+
+    explicit MetadataCacheConfig(const H5AC_cache_config_t& config);
+    explicit MetadataCacheConfig(const FileAccessProps& fapl);
+
+    size_t getInitialSize() const;
+    size_t getMinSize() const;
+    size_t getMaxSize() const;
+
+    /// \brief The complete configuration of the cache.
+    const H5AC_cache_config_t& getConfig() const;
+
+  private:
+    friend FileAccessProps;
+    void apply(hid_t list) const;
+
+    H5AC_cache_config_t _config;
+};
+
 #if H5_VERSION_GE(1, 10, 1)
 ///
 /// \brief Configure the file space strategy.
@@ -572,6 +611,27 @@ class AllocationTime {
     H5D_alloc_time_t _alloc_time;
 };
 
+///
+/// \brief When to write the fill value into newly allocated storage.
+///
+/// Setting `H5D_FILL_TIME_NEVER` avoids writing fill values into storage that
+/// will be overwritten anyway. Combine with `AllocationTime`. Please, consider
+/// the upstream documentation for `H5Pset_fill_time`.
+/// \implements PropertyInterface
+class FillTime {
+  public:
+    explicit FillTime(H5D_fill_time_t fill_time);
+    explicit FillTime(const DataSetCreateProps& dcpl);
+
+    H5D_fill_time_t getFillTime() const;
+
+  private:
+    friend DataSetCreateProps;
+    void apply(hid_t dcpl) const;
+
+    H5D_fill_time_t _fill_time;
+};
+
 /// Dataset access property to control chunk cache configuration.
 /// Do not confuse with the similar file access property for H5Pset_cache
 /// \implements PropertyInterface
@@ -584,6 +644,7 @@ class Caching {
             const double w0 = static_cast<double>(H5D_CHUNK_CACHE_W0_DEFAULT));
 
     explicit Caching(const DataSetCreateProps& dcpl);
+    explicit Caching(const DataSetAccessProps& dapl);
 
     size_t getNumSlots() const;
     size_t getCacheSize() const;
@@ -615,6 +676,99 @@ class CreateIntermediateGroup {
     bool _create;
 };
 
+///
+/// \brief Configure the buffers HDF5 uses to convert datatypes.
+///
+/// A transfer in which the memory and file datatype differ is converted in
+/// pieces that fit into the type conversion buffer, 1 MiB by default. The
+/// buffers can be provided by the caller, in which case they must be at least
+/// `size` bytes and outlive every transfer using the property list.
+///
+/// See the upstream documentation of `H5Pset_buffer`.
+///
+/// \implements PropertyInterface
+/// \since 3.0
+class TypeConversionBuffer {
+  public:
+    explicit TypeConversionBuffer(size_t size,
+                                  void* conversion_buffer = nullptr,
+                                  void* background_buffer = nullptr);
+
+    explicit TypeConversionBuffer(const DataTransferProps& dxpl);
+
+    size_t getSize() const;
+    void* getConversionBuffer() const;
+    void* getBackgroundBuffer() const;
+
+  private:
+    friend DataTransferProps;
+    void apply(hid_t hid) const;
+
+    size_t _size;
+    void* _conversion_buffer;
+    void* _background_buffer;
+};
+
+///
+/// \brief Number of I/O vectors collected before reading or writing a hyperslab.
+///
+/// Selections consisting of many small blocks, e.g. strided selections, are
+/// processed in batches of this many contiguous pieces, 1024 by default.
+///
+/// See the upstream documentation of `H5Pset_hyper_vector_size`.
+///
+/// \implements PropertyInterface
+/// \since 3.0
+class HyperslabVectorSize {
+  public:
+    explicit HyperslabVectorSize(size_t size);
+    explicit HyperslabVectorSize(const DataTransferProps& dxpl);
+
+    size_t getSize() const;
+
+  private:
+    friend DataTransferProps;
+    void apply(hid_t hid) const;
+
+    size_t _size;
+};
+
+///
+/// \brief Let `read` and `write` size the transfer buffers for each transfer.
+///
+/// Before every `read` or `write` with these transfer properties, the type
+/// conversion buffer is grown to fit the entire selection, if a conversion is
+/// needed, and the hyperslab vector size is grown to the number of blocks of
+/// the selection. Neither grows beyond `max_buffer_size` bytes. Buffers
+/// provided by the caller through `TypeConversionBuffer` are not changed.
+///
+/// The property is stored in the property list, but only HighFive reads it.
+/// An `AutoTransferBuffers(0)` disables the automatic sizing.
+///
+/// \implements PropertyInterface
+/// \since 3.0
+class AutoTransferBuffers {
+  public:
+    explicit AutoTransferBuffers(size_t max_buffer_size = 64 * 1024 * 1024);
+
+    /// \brief Read the property, a `max_buffer_size` of `0` if it's not set.
+    explicit AutoTransferBuffers(const DataTransferProps& dxpl);
+
+    size_t getMaxBufferSize() const;
+    bool isEnabled() const;
+
+  private:
+    friend DataTransferProps;
+    void apply(hid_t hid) const;
+
+    // Until the property is added to a list, no list is checked for it.
+    static std::atomic<bool>& isAdded() noexcept;
+
+    static constexpr const char* property_name = "highfive_auto_transfer_buffers";
+
+    size_t _max_buffer_size;
+};
+
 #ifdef H5_HAVE_PARALLEL
 /// \implements PropertyInterface
 class UseCollectiveIO {
@@ -16,7 +16,12 @@
 namespace HighFive {
 
 namespace detail {
-Selection make_selection(const DataSpace&, const DataSpace&, const DataSet&);
+Selection make_selection(DataSpace, DataSpace, DataSet);
+}
+
+namespace details {
+const DataSpace& get_mem_space(const Selection&);
+const DataSpace& get_file_space(const Selection&);
 }
 
 ///
@@ -52,7 +57,7 @@ class Selection: public SliceTraits<Selection> {
     const DataType getDataType() const;
 
   protected:
-    Selection(const DataSpace& memspace, const DataSpace& file_space, const DataSet& set);
+    Selection(DataSpace memspace, DataSpace file_space, DataSet set);
 
   private:
     DataSpace _mem_space, _file_space;
@@ -62,7 +67,9 @@ class Selection: public SliceTraits<Selection> {
     template <typename Derivate>
     friend class ::HighFive::SliceTraits;
 #endif
-    friend Selection detail::make_selection(const DataSpace&, const DataSpace&, const DataSet&);
+    friend Selection detail::make_selection(DataSpace, DataSpace, DataSet);
+    friend const DataSpace& details::get_mem_space(const Selection&);
+    friend const DataSpace& details::get_file_space(const Selection&);
 };
 
 }  // namespace HighFive
@@ -0,0 +1,149 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5File.hpp"
+
+namespace HighFive {
+
+///
+/// \brief How a dataset is stored, see `StorageAudit`.
+///
+/// \since 3.0
+struct DataSetStorageInfo {
+    /// Absolute path of the dataset.
+    std::string path;
+
+    /// The layout of the dataset, e.g. `H5D_CHUNKED`.
+    H5D_layout_t layout = H5D_CONTIGUOUS;
+
+    /// The dimensions of the dataset.
+    std::vector<size_t> dimensions;
+
+    /// Number of elements times the size of the datatype in the file. For
+    /// variable length data only the size of the references to the heap is
+    /// counted.
+    uint64_t logical_bytes = 0;
+
+    /// Bytes allocated in the file for the raw data, see `getStorageSize`.
+    uint64_t storage_bytes = 0;
+
+    /// Shape of the chunks, empty unless the dataset is chunked.
+    std::vector<hsize_t> chunk_dimensions;
+
+    /// Number of chunks for which storage was allocated.
+    size_t n_allocated_chunks = 0;
+
+    /// Number of chunks needed to cover the current extent of the dataset.
+    size_t n_possible_chunks = 0;
+
+    /// Smallest number of bytes a chunk occupies in the file.
+    ///
+    /// The smallest and largest chunk are zero, if listing the chunks is too
+    /// expensive, see `DataSet::getAllocatedRegion`.
+    uint64_t min_chunk_bytes = 0;
+
+    /// Largest number of bytes a chunk occupies in the file.
+    uint64_t max_chunk_bytes = 0;
+
+    /// Average number of bytes an allocated chunk occupies in the file.
+    double mean_chunk_bytes = 0.0;
+
+    /// Names of the filters in the pipeline, e.g. `deflate`.
+    std::vector<std::string> filters;
+
+    ///
+    /// \brief Logical bytes per stored byte, or `0` if nothing is stored.
+    ///
+    double getCompressionRatio() const {
+        return storage_bytes == 0 ? 0.0 : double(logical_bytes) / double(storage_bytes);
+    }
+};
+
+///
+/// \brief Reports how efficiently the datasets of a file are stored.
+///
+/// For every dataset the audit records the logical and stored size, the
+/// layout, chunking, allocated chunks and filters. For the file it records the
+/// size and the space lost to free space and metadata. Only metadata is
+/// read, no raw data.
+///
+/// This is intended to find datasets which are badly chunked or not
+/// compressed, e.g. across many files:
+///
+/// \code{.cpp}
+/// for (const auto& filename: filenames) {
+///     StorageAudit audit(File(filename, File::ReadOnly));
+///     audit.write(csv);
+/// }
+/// \endcode
+///
+/// Datasets reachable through several hard links are reported once. Chunk
+/// statistics require HDF5 1.10.5 or newer.
+///
+/// \since 3.0
+class StorageAudit {
+  public:
+    ///
+    /// \brief Audit every dataset in `file`.
+    ///
+    explicit StorageAudit(const File& file);
+
+    /// \brief The datasets, in the order they were found.
+    const std::vector<DataSetStorageInfo>& getDataSets() const noexcept;
+
+    /// \brief The name of the audited file.
+    const std::string& getFileName() const noexcept;
+
+    /// \brief The size of the file in bytes.
+    uint64_t getFileSize() const noexcept;
+
+    /// \brief The unused space in bytes tracked by the free space manager.
+    uint64_t getFreeSpace() const noexcept;
+
+    /// \brief The size of the superblock and its extension in bytes.
+    uint64_t getSuperblockSize() const noexcept;
+
+    /// \brief The size of the metadata of the free space manager in bytes.
+    uint64_t getFreeSpaceMetadataSize() const noexcept;
+
+    /// \brief The sum of the logical bytes of all datasets.
+    uint64_t getLogicalBytes() const noexcept;
+
+    /// \brief The sum of the stored bytes of all datasets.
+    uint64_t getStorageBytes() const noexcept;
+
+    ///
+    /// \brief Write one CSV line per dataset into `os`.
+    ///
+    /// The first column is the name of the file, such that the audits of
+    /// several files can be concatenated. If `header` is true, a line with
+    /// the names of the columns is written first.
+    void write(std::ostream& os, bool header = true) const;
+
+  private:
+    static DataSetStorageInfo audit(const DataSet& dataset, const std::string& path);
+
+    std::string _file_name;
+    uint64_t _file_size = 0;
+    uint64_t _free_space = 0;
+    uint64_t _superblock_size = 0;
+    uint64_t _free_space_metadata_size = 0;
+    std::vector<DataSetStorageInfo> _datasets;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5StorageAudit_misc.hpp"
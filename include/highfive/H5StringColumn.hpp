@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5Group.hpp"
+#include "H5PropertyList.hpp"
+#include "H5Selection.hpp"
+#include "H5StringTable.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A column of strings stored as bytes and offsets.
+///
+/// Variable length strings are stored in the global heap of the file, one heap
+/// object per string. They can't be compressed and writing them is slow. A
+/// `StringColumn` stores the strings in a group with two chunked datasets,
+/// which can be compressed like numeric data:
+///
+/// - `bytes`: all strings concatenated, without separators, as `uint8`;
+/// - `offsets`: `size() + 1` offsets, as `uint64`; string `i` is
+///   `bytes[offsets[i]:offsets[i + 1]]`.
+///
+/// The group is marked by the attribute `highfive_string_column`, which holds
+/// the version of the format, currently `1`.
+///
+/// \code{.cpp}
+/// DataSetCreateProps props;
+/// props.add(Shuffle());
+/// props.add(Deflate(4));
+/// auto column = StringColumn::create(file, "names", names, props);
+///
+/// auto names = StringColumn::open(file, "names").read(1000, 100);
+/// \endcode
+///
+/// Reading a range of strings reads the corresponding range of both datasets,
+/// i.e. only the chunks which overlap with it.
+///
+/// \since 3.0
+class StringColumn {
+  public:
+    ///
+    /// \brief Create the column `name` in `node` and write `strings` to it.
+    ///
+    /// The filters in `create_props` apply to both datasets. The chunk size of
+    /// the bytes, if any, is used for both datasets, otherwise chunks are
+    /// 256 KiB.
+    template <class Node>
+    static StringColumn create(
+        Node& node,
+        const std::string& name,
+        const std::vector<std::string>& strings,
+        const DataSetCreateProps& create_props = DataSetCreateProps::Default());
+
+    ///
+    /// \brief Open the column `name` in `node`.
+    ///
+    template <class Node>
+    static StringColumn open(const Node& node, const std::string& name);
+
+    ///
+    /// \brief Check if `name` in `node` is a string column.
+    ///
+    template <class Node>
+    static bool isStringColumn(const Node& node, const std::string& name);
+
+    /// \brief The number of strings.
+    size_t size() const;
+
+    /// \brief The total length of all strings in bytes.
+    size_t getByteSize() const;
+
+    /// \brief The group holding the column.
+    const Group& getGroup() const noexcept {
+        return _group;
+    }
+
+    ///
+    /// \brief Append `strings` to the column.
+    ///
+    void append(const std::vector<std::string>& strings,
+                const DataTransferProps& xfer_props = DataTransferProps());
+
+    ///
+    /// \brief Read all strings.
+    ///
+    std::vector<std::string> read(const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// \brief Read the `count` strings starting at `offset`.
+    ///
+    std::vector<std::string> read(size_t offset,
+                                  size_t count,
+                                  const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// \brief Read all strings into a `StringTable`.
+    ///
+    StringTable readTable(const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// \brief Read the `count` strings starting at `offset` into a `StringTable`.
+    ///
+    StringTable readTable(size_t offset,
+                          size_t count,
+                          const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+  private:
+    explicit StringColumn(const Group& group);
+
+    // Read the `count + 1` offsets of the range, made relative to its first
+    // string, and return the position of its first byte.
+    uint64_t readOffsets(size_t offset,
+                         size_t count,
+                         const DataTransferProps& xfer_props,
+                         std::vector<uint64_t>& offsets) const;
+
+    // Read the `n_bytes` bytes starting at byte `begin`.
+    void readBytes(uint64_t begin,
+                   size_t n_bytes,
+                   char* bytes,
+                   const DataTransferProps& xfer_props) const;
+
+    Group _group;
+    DataSet _bytes;
+    DataSet _offsets;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5StringColumn_misc.hpp"
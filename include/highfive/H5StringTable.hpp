@@ -0,0 +1,173 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if HIGHFIVE_CXX_STD >= 17
+#include <string_view>
+#endif
+
+#include "H5DataType.hpp"
+#include "bits/H5Inspector_decl.hpp"
+
+namespace HighFive {
+
+class StringColumn;
+
+///
+/// \brief Strings stored one after the other in a single buffer.
+///
+/// Reading into `std::vector<std::string>` allocates every string separately.
+/// A `StringTable` copies all strings into one buffer, the arena, and records
+/// where each of them starts, i.e. reading needs a constant number of
+/// allocations, independent of the number of strings:
+///
+/// \code{.cpp}
+/// auto names = dataset.read<StringTable>();
+/// for (size_t i = 0; i < names.size(); ++i) {
+///     std::string_view name = names[i];
+/// }
+/// \endcode
+///
+/// Fixed and variable length string datasets can be read and written. Unlike
+/// `std::string`, the padding of fixed-length strings is removed, e.g. the
+/// trailing spaces of space padded strings. Every string in the arena is
+/// followed by a `\0`, which allows writing variable length strings without
+/// copying them.
+///
+/// Elements are `std::string_view` in C++17; in C++14 use `data` and `length`.
+///
+/// \since 3.0
+class StringTable {
+  public:
+    StringTable() = default;
+
+    /// \brief Copy `strings` into the arena.
+    explicit StringTable(const std::vector<std::string>& strings);
+
+    /// \brief The number of strings.
+    size_t size() const noexcept {
+        return _offsets.size() - 1;
+    }
+
+    /// \brief Whether there are no strings.
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /// \brief Reserve space for `n_strings` strings with `n_bytes` characters in total.
+    void reserve(size_t n_strings, size_t n_bytes);
+
+    /// \brief Append the `length` bytes starting at `data`.
+    void push_back(const char* data, size_t length);
+
+    /// \brief Append `value`.
+    void push_back(const std::string& value) {
+        push_back(value.data(), value.size());
+    }
+
+    /// \brief Remove all strings, the arena keeps its capacity.
+    void clear() noexcept;
+
+    /// \brief Pointer to the null-terminated string `i`.
+    const char* data(size_t i) const {
+        return _arena.data() + _offsets[i];
+    }
+
+    /// \brief The length in bytes of string `i`, excluding the `\0`.
+    size_t length(size_t i) const {
+        return _offsets[i + 1] - _offsets[i] - 1;
+    }
+
+    /// \brief A copy of string `i`.
+    std::string getString(size_t i) const {
+        return std::string(data(i), length(i));
+    }
+
+#if HIGHFIVE_CXX_STD >= 17
+    /// \brief String `i`, which is valid while the table isn't modified.
+    std::string_view operator[](size_t i) const {
+        return std::string_view(data(i), length(i));
+    }
+#endif
+
+    /// \brief The size of the arena in bytes, including the `\0`s.
+    size_t getArenaSize() const noexcept {
+        return _arena.size();
+    }
+
+    /// \brief Copy all strings into a `std::vector<std::string>`.
+    std::vector<std::string> toVector() const;
+
+  private:
+    friend struct details::inspector<StringTable>;
+    friend class StringColumn;
+
+    std::vector<char> _arena;
+    // String `i` occupies `[_offsets[i], _offsets[i + 1])`, including its `\0`.
+    std::vector<size_t> _offsets = {0};
+};
+
+namespace details {
+
+template <>
+struct inspector<StringTable> {
+    using type = StringTable;
+    using value_type = std::string;
+    using base_type = std::string;
+    using hdf5_type = const char*;
+
+    static constexpr size_t ndim = 1;
+    static constexpr size_t min_ndim = ndim;
+    static constexpr size_t max_ndim = ndim;
+
+    static constexpr bool is_trivially_copyable = false;
+    static constexpr bool is_trivially_nestable = false;
+
+    static size_t getRank(const type& /* val */) {
+        return ndim;
+    }
+
+    static std::vector<size_t> getDimensions(const type& val) {
+        return {val.size()};
+    }
+
+    static void prepare(type& val, const std::vector<size_t>& dims) {
+        if (dims.size() > 1) {
+            throw DataSpaceException("StringTable is only 1 dimension.");
+        }
+        val.clear();
+    }
+
+    static hdf5_type* data(type& /* val */) {
+        throw DataSpaceException("A StringTable cannot be read directly.");
+    }
+
+    static const hdf5_type* data(const type& /* val */) {
+        throw DataSpaceException("A StringTable cannot be written directly.");
+    }
+
+    template <class It>
+    static void serialize(const type& val, const std::vector<size_t>& /* dims */, It m) {
+        for (size_t i = 0; i < val.size(); ++i) {
+            (*(m + i)).assign(val.data(i), val.length(i), StringPadding::NullTerminated);
+        }
+    }
+
+    template <class It>
+    static void unserialize(const It& vec, const std::vector<size_t>& dims, type& val);
+};
+
+}  // namespace details
+}  // namespace HighFive
+
+#include "bits/H5StringTable_misc.hpp"
@@ -0,0 +1,183 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5DataType.hpp"
+#include "H5File.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A snapshot of the structure of a file.
+///
+/// The index is built in a single traversal of the file and records for every
+/// object its type and, for datasets, the dimensions and datatype. The names
+/// of the attributes of every object are recorded too. Queries are answered
+/// from memory without touching the HDF5 metadata of the file.
+///
+/// The index can be saved to a sidecar file. It records the size and free
+/// space reported by HDF5, the number of objects in the root group and, with
+/// C++17, the modification time of the file it was built for; `matches`
+/// checks if a loaded index is still valid. This is meant for files that are
+/// opened read-only many times, e.g. at the start of a service:
+///
+/// \code{.cpp}
+/// File file("data.h5", File::ReadOnly);
+/// auto index = StructureIndex::loadOrBuild(file, "data.h5.idx");
+/// if (index.exist("/group/dset")) {
+///     auto dims = index.getDimensions("/group/dset");
+/// }
+/// \endcode
+///
+/// Soft and external links are recorded, but not followed. Paths through
+/// additional hard links to a group are resolved to the first path under
+/// which the group was found.
+///
+/// \since 3.0
+class StructureIndex {
+  public:
+    ///
+    /// \brief Build the index of `file` by traversing it once.
+    ///
+    explicit StructureIndex(const File& file);
+
+    ///
+    /// \brief Check that the index was built for `file` in its current state.
+    ///
+    /// Compares the size and free space of the file, as reported by HDF5, and
+    /// the number of objects in its root group with the values recorded when
+    /// the index was built. With C++17 the modification time, as reported by
+    /// `std::filesystem`, is compared too.
+    ///
+    /// Without C++17 this check is weak: a modification which preserves all
+    /// of them, e.g. replacing a dataset deeper in the file by one of the same
+    /// size, isn't detected. Rebuild the index if that can happen.
+    bool matches(const File& file) const;
+
+    ///
+    /// \brief Check if an object, or link, exists at `path`.
+    ///
+    /// Paths are relative to the root group, a leading `/` is optional.
+    bool exist(const std::string& path) const;
+
+    ///
+    /// \brief Type of the object at `path`.
+    ///
+    /// Soft and external links are reported as `ObjectType::Other`.
+    ObjectType getObjectType(const std::string& path) const;
+
+    ///
+    /// \brief The dimensions of the dataset at `path`.
+    ///
+    std::vector<size_t> getDimensions(const std::string& path) const;
+
+    ///
+    /// \brief The datatype of the dataset at `path`.
+    ///
+    DataType getDataType(const std::string& path) const;
+
+    ///
+    /// \brief The names of the attributes of the object at `path`.
+    ///
+    std::vector<std::string> listAttributeNames(const std::string& path) const;
+
+    ///
+    /// \brief The names of the objects in the group at `path`, ordered by name.
+    ///
+    std::vector<std::string> listObjectNames(const std::string& path = "/") const;
+
+    ///
+    /// \brief Open the dataset at `path`.
+    ///
+    /// Missing paths and paths which aren't datasets are detected from the
+    /// index, i.e. without a failing call to HDF5.
+    DataSet getDataSet(const File& file, const std::string& path) const;
+
+    ///
+    /// \brief Number of objects and links in the index, including the root.
+    ///
+    size_t size() const noexcept;
+
+    ///
+    /// \brief Serialize the index into a binary stream.
+    ///
+    void save(std::ostream& os) const;
+
+    ///
+    /// \brief Serialize the index into the file `filename`.
+    ///
+    void save(const std::string& filename) const;
+
+    ///
+    /// \brief Deserialize an index saved with `save`.
+    ///
+    /// The index is checked against a checksum, a corrupt index results in a
+    /// `FileException`.
+    static StructureIndex load(std::istream& is);
+
+    ///
+    /// \brief Deserialize an index from the file `filename`.
+    ///
+    static StructureIndex load(const std::string& filename);
+
+    ///
+    /// \brief Load the index from `filename` or, if it's missing or outdated,
+    /// build it and save it to `filename`.
+    ///
+    /// Failing to save the index, e.g. because the directory is read-only,
+    /// isn't an error.
+    static StructureIndex loadOrBuild(const File& file, const std::string& filename);
+
+  private:
+    struct Entry {
+        ObjectType object_type = ObjectType::Other;
+        std::vector<size_t> dimensions;
+        DataType data_type;
+        std::vector<std::string> attribute_names;
+    };
+
+    // What identifies the state of the file the index was built for.
+    struct FileIdentity {
+        uint64_t size = 0;
+        uint64_t free_space = 0;
+        uint64_t n_root_objects = 0;
+
+        // In nanoseconds, -1 if unknown.
+        int64_t mtime = -1;
+
+        static FileIdentity read(const File& file);
+        bool operator==(const FileIdentity& other) const noexcept;
+    };
+
+    StructureIndex() = default;
+
+    static std::string normalize(const std::string& path);
+
+    std::string resolve(const std::string& path) const;
+    const Entry& getEntry(const std::string& path) const;
+    const Entry& getDataSetEntry(const std::string& path) const;
+
+    FileIdentity _file_identity;
+    std::map<std::string, Entry> _entries;
+
+    // Additional hard links to groups, mapped to the path the group was found
+    // under first.
+    std::map<std::string, std::string> _aliases;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5StructureIndex_misc.hpp"
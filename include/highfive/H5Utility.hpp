@@ -15,6 +15,7 @@
 
 #include "bits/h5e_wrapper.hpp"
 #include "bits/H5Friends.hpp"
+#include "bits/H5Instrumentation.hpp"
 
 namespace HighFive {
 
@@ -0,0 +1,93 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "H5DataType.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A brain floating point number, i.e. the upper 16 bits of a `float`.
+///
+/// `bfloat16_t` has the range of `float` but only 8 bits of precision. It's
+/// only a storage type: values are converted to `float` for arithmetic.
+/// Datasets of `bfloat16_t` use a custom HDF5 floating point type, see
+/// `details::create_bfloat16_datatype`, and can be read into `float`:
+///
+/// \code{.cpp}
+/// std::vector<bfloat16_t> activations = ...;
+/// file.createDataSet("activations", activations);
+///
+/// auto values = file.getDataSet("activations").read<std::vector<float>>();
+/// \endcode
+///
+/// Conversions to and from `float` are vectorized after calling
+/// `register_fast_conversions`, see `H5FastConversion.hpp`.
+///
+/// \since 3.0
+class bfloat16_t {
+  public:
+    /// \brief Uninitialized, like `float`.
+    bfloat16_t() = default;
+
+    ///
+    /// \brief Round `value` to the nearest `bfloat16_t`, ties to even.
+    ///
+    /// Values which round beyond the largest `bfloat16_t` become infinity,
+    /// subnormal values are kept and NaNs stay NaN.
+    explicit bfloat16_t(float value) noexcept {
+        uint32_t x;
+        std::memcpy(&x, &value, sizeof(x));
+        if ((x & 0x7fffffffu) > 0x7f800000u) {
+            // Set a bit of the mantissa, such that truncating it keeps a NaN.
+            _bits = static_cast<uint16_t>((x >> 16) | 0x40u);
+        } else {
+            _bits = static_cast<uint16_t>((x + 0x7fffu + ((x >> 16) & 1u)) >> 16);
+        }
+    }
+
+    /// \brief The value as `float`, which is exact.
+    operator float() const noexcept {
+        const uint32_t x = uint32_t(_bits) << 16;
+        float value;
+        std::memcpy(&value, &x, sizeof(value));
+        return value;
+    }
+
+    /// \brief The `bfloat16_t` with the bit pattern `bits`.
+    static bfloat16_t fromBits(uint16_t bits) noexcept {
+        bfloat16_t value;
+        value._bits = bits;
+        return value;
+    }
+
+    /// \brief The bit pattern, i.e. the upper 16 bits of the `float`.
+    uint16_t getBits() const noexcept {
+        return _bits;
+    }
+
+  private:
+    uint16_t _bits;
+};
+
+// Required by the generic `inspector`, which reads and writes `bfloat16_t`
+// like any other trivially copyable atomic type.
+static_assert(sizeof(bfloat16_t) == 2 && std::is_trivially_copyable<bfloat16_t>::value,
+              "bfloat16_t must be stored as two bytes.");
+
+template <>
+inline AtomicType<bfloat16_t>::AtomicType() {
+    _hid = details::create_bfloat16_datatype();
+}
+
+}  // namespace HighFive
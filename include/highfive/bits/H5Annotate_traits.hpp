@@ -8,9 +8,11 @@
  */
 #pragma once
 
+#include <map>
 #include <string>
 
 #include "../H5Attribute.hpp"
+#include "H5Optional.hpp"
 
 namespace HighFive {
 
@@ -60,6 +62,16 @@ class AnnotateTraits {
     /// \return the attribute object
     Attribute getAttribute(const std::string& attribute_name) const;
 
+    ///
+    /// \brief Open the attribute `attribute_name`, if it exists.
+    ///
+    /// Unlike `getAttribute`, a missing attribute isn't an error: it's detected
+    /// with `H5Aexists`, hence no exception is created and nothing is pushed
+    /// onto the HDF5 error stack. Only existing attributes are opened.
+    ///
+    /// \since 3.0
+    Optional<Attribute> tryGetAttribute(const std::string& attribute_name) const;
+
     ///
     /// \brief return the number of attributes of the node / group
     /// \return number of attributes
@@ -75,6 +87,29 @@ class AnnotateTraits {
     /// \return number of attributes
     bool hasAttribute(const std::string& attr_name) const;
 
+    ///
+    /// \brief Read all attributes of this object in a single pass.
+    ///
+    /// Iterates over the attributes with `H5Aiterate` and opens each exactly
+    /// once. Numbers and strings are decoded, see `AttributeValue`; for
+    /// attributes of other types only the datatype and dimensions are
+    /// retrieved.
+    ///
+    /// \return the attributes by name.
+    /// \since 3.0
+    std::map<std::string, AttributeValue> readAllAttributes() const;
+
+    ///
+    /// \brief Create and write several attributes in one call.
+    ///
+    /// Numbers are stored as 64-bit integers or doubles, strings as variable
+    /// length strings. The datatypes, and dataspaces of equal dimensions, are
+    /// created once and shared by all attributes.
+    ///
+    /// \param attributes The values to write by name, none may exist already.
+    /// \since 3.0
+    void createAttributes(const std::map<std::string, AttributeValue>& attributes);
+
   private:
     using derivate_type = Derivate;
 };
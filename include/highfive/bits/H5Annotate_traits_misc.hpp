@@ -8,6 +8,8 @@
  */
 #pragma once
 
+#include <exception>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -65,6 +67,17 @@ inline Attribute AnnotateTraits<Derivate>::getAttribute(const std::string& attri
     return detail::make_attribute(attr_id);
 }
 
+template <typename Derivate>
+inline Optional<Attribute> AnnotateTraits<Derivate>::tryGetAttribute(
+    const std::string& attribute_name) const {
+    // `H5Aexists` reports a missing attribute without pushing an error.
+    const hid_t id = static_cast<const Derivate*>(this)->getId();
+    if (detail::h5a_exists(id, attribute_name.c_str()) == 0) {
+        return {};
+    }
+    return detail::make_attribute(detail::h5a_open(id, attribute_name.c_str(), H5P_DEFAULT));
+}
+
 template <typename Derivate>
 inline size_t AnnotateTraits<Derivate>::getNumberAttributes() const {
     int res = detail::h5a_get_num_attrs(static_cast<const Derivate*>(this)->getId());
@@ -89,6 +102,91 @@ inline std::vector<std::string> AnnotateTraits<Derivate>::listAttributeNames() c
     return names;
 }
 
+namespace details {
+
+struct HighFiveReadAttributesData {
+    std::map<std::string, AttributeValue>& attributes;
+    std::exception_ptr err;
+};
+
+inline herr_t internal_high_five_read_attribute(hid_t loc_id,
+                                                const char* name,
+                                                const H5A_info_t* /*info*/,
+                                                void* op_data) {
+    auto* data = static_cast<HighFiveReadAttributesData*>(op_data);
+    try {
+        auto attribute = detail::make_attribute(detail::h5a_open(loc_id, name, H5P_DEFAULT));
+        data->attributes.emplace(name, detail::read_attribute_value(attribute));
+        return 0;
+    } catch (...) {
+        data->err = std::current_exception();
+    }
+    return 1;
+}
+
+}  // namespace details
+
+template <typename Derivate>
+inline std::map<std::string, AttributeValue> AnnotateTraits<Derivate>::readAllAttributes() const {
+    std::map<std::string, AttributeValue> attributes;
+    details::HighFiveReadAttributesData data{attributes, nullptr};
+
+    detail::h5a_iterate2(static_cast<const Derivate*>(this)->getId(),
+                         H5_INDEX_NAME,
+                         H5_ITER_INC,
+                         nullptr,
+                         &details::internal_high_five_read_attribute,
+                         static_cast<void*>(&data));
+
+    if (data.err) {
+        std::rethrow_exception(data.err);
+    }
+    return attributes;
+}
+
+template <typename Derivate>
+inline void AnnotateTraits<Derivate>::createAttributes(
+    const std::map<std::string, AttributeValue>& attributes) {
+    const DataType integer_type = create_datatype<int64_t>();
+    const DataType unsigned_type = create_datatype<uint64_t>();
+    const DataType float_type = create_datatype<double>();
+    const DataType string_type = VariableLengthStringType();
+
+    const DataSpace scalar_space(DataSpace::dataspace_scalar);
+    std::map<std::vector<size_t>, DataSpace> spaces;
+
+    std::vector<const char*> strings;
+    for (const auto& kv: attributes) {
+        const auto& value = kv.second;
+        const void* buffer = detail::attribute_value_data(value, strings);
+
+        const DataType* dtype = &string_type;
+        switch (value.getKind()) {
+        case AttributeValue::Kind::Integer:
+            dtype = &integer_type;
+            break;
+        case AttributeValue::Kind::Unsigned:
+            dtype = &unsigned_type;
+            break;
+        case AttributeValue::Kind::Float:
+            dtype = &float_type;
+            break;
+        default:
+            break;
+        }
+
+        const auto& dims = value.getDimensions();
+        auto it = spaces.find(dims);
+        if (!dims.empty() && it == spaces.end()) {
+            it = spaces.emplace(dims, DataSpace(dims)).first;
+        }
+        const DataSpace& space = dims.empty() ? scalar_space : it->second;
+
+        auto attribute = createAttribute(kv.first, space, *dtype);
+        detail::h5a_write(attribute.getId(), dtype->getId(), buffer);
+    }
+}
+
 template <typename Derivate>
 inline bool AnnotateTraits<Derivate>::hasAttribute(const std::string& attr_name) const {
     return detail::h5a_exists(static_cast<const Derivate*>(this)->getId(), attr_name.c_str()) > 0;
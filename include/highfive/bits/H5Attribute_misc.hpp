@@ -24,6 +24,8 @@
 #include "H5Utils.hpp"
 #include "h5a_wrapper.hpp"
 #include "h5d_wrapper.hpp"
+#include "h5s_wrapper.hpp"
+#include "h5t_wrapper.hpp"
 #include "squeeze.hpp"
 #include "assert_compatible_spaces.hpp"
 
@@ -93,10 +95,11 @@ inline void Attribute::read(T& array) const {
     // re-arrange results
     r.unserialize(array);
 
-    auto t = buffer_info.data_type;
+    const auto& t = buffer_info.data_type;
     auto c = t.getClass();
 
     if (c == DataTypeClass::VarLen || t.isVariableStr()) {
+        HIGHFIVE_TIME_CONVERSION(ReclaimNs);
 #if H5_VERSION_GE(1, 12, 0)
         // This one have been created in 1.12.0
         (void) detail::h5t_reclaim(t.getId(), mem_space.getId(), H5P_DEFAULT, r.getPointer());
@@ -180,4 +183,205 @@ inline Attribute Attribute::reshapeMemSpace(const std::vector<size_t>& new_dims)
     return attr;
 }
 
+template <typename T, typename>
+inline AttributeValue::AttributeValue(T value) {
+    if (std::is_floating_point<T>::value) {
+        _kind = Kind::Float;
+        _floats.push_back(static_cast<double>(value));
+    } else if (std::is_signed<T>::value) {
+        _kind = Kind::Integer;
+        _integers.push_back(static_cast<int64_t>(value));
+    } else {
+        _kind = Kind::Unsigned;
+        _unsigned.push_back(static_cast<uint64_t>(value));
+    }
+}
+
+inline AttributeValue::AttributeValue(const char* value)
+    : AttributeValue(std::string(value)) {}
+
+inline AttributeValue::AttributeValue(std::string value)
+    : _kind(Kind::String)
+    , _strings{std::move(value)} {}
+
+template <typename T>
+inline AttributeValue::AttributeValue(const std::vector<T>& values)
+    : _dims{values.size()} {
+    static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value,
+                  "Only vectors of numbers or strings are supported.");
+    if (std::is_floating_point<T>::value) {
+        _kind = Kind::Float;
+        _floats.assign(values.begin(), values.end());
+    } else if (std::is_signed<T>::value) {
+        _kind = Kind::Integer;
+        _integers.assign(values.begin(), values.end());
+    } else {
+        _kind = Kind::Unsigned;
+        _unsigned.assign(values.begin(), values.end());
+    }
+}
+
+inline AttributeValue::AttributeValue(std::vector<std::string> values)
+    : _kind(Kind::String)
+    , _dims{values.size()}
+    , _strings(std::move(values)) {}
+
+inline AttributeValue::Kind AttributeValue::getKind() const noexcept {
+    return _kind;
+}
+
+inline const std::vector<size_t>& AttributeValue::getDimensions() const noexcept {
+    return _dims;
+}
+
+inline const DataType& AttributeValue::getDataType() const noexcept {
+    return _datatype;
+}
+
+template <typename T>
+inline T AttributeValue::get() const {
+    T value;
+    _get(value);
+    return value;
+}
+
+template <typename T>
+inline void AttributeValue::_get(T& value) const {
+    static_assert(std::is_arithmetic<T>::value, "Only numbers, strings or vectors thereof.");
+    std::vector<T> values;
+    _get(values);
+    if (values.size() != 1) {
+        throw DataSpaceException("Impossible to read an attribute with " +
+                                 std::to_string(values.size()) + " elements into a scalar.");
+    }
+    value = values[0];
+}
+
+inline void AttributeValue::_get(std::string& value) const {
+    std::vector<std::string> values;
+    _get(values);
+    if (values.size() != 1) {
+        throw DataSpaceException("Impossible to read an attribute with " +
+                                 std::to_string(values.size()) + " elements into a scalar.");
+    }
+    value = std::move(values[0]);
+}
+
+template <typename T>
+inline void AttributeValue::_get(std::vector<T>& values) const {
+    static_assert(std::is_arithmetic<T>::value, "Only numbers, strings or vectors thereof.");
+    switch (_kind) {
+    case Kind::Integer:
+        values.assign(_integers.begin(), _integers.end());
+        return;
+    case Kind::Unsigned:
+        values.assign(_unsigned.begin(), _unsigned.end());
+        return;
+    case Kind::Float:
+        values.assign(_floats.begin(), _floats.end());
+        return;
+    default:
+        throw DataTypeException("Impossible to convert the attribute value to a number.");
+    }
+}
+
+inline void AttributeValue::_get(std::vector<std::string>& values) const {
+    if (_kind != Kind::String) {
+        throw DataTypeException("Impossible to convert the attribute value to a string.");
+    }
+    values = _strings;
+}
+
+namespace detail {
+
+inline AttributeValue read_attribute_value(const Attribute& attribute) {
+    AttributeValue value;
+    value._datatype = attribute.getDataType();
+
+    auto space = attribute.getSpace();
+    value._dims = space.getDimensions();
+    const size_t n_elements = space.getElementCount();
+    if (detail::h5s_get_simple_extent_type(space.getId()) == H5S_NULL) {
+        return value;
+    }
+
+    const hid_t file_type = value._datatype.getId();
+    switch (value._datatype.getClass()) {
+    case DataTypeClass::Integer:
+        if (detail::h5t_get_sign(file_type) == H5T_SGN_NONE) {
+            value._kind = AttributeValue::Kind::Unsigned;
+            value._unsigned.resize(n_elements);
+            detail::h5a_read(attribute.getId(), H5T_NATIVE_UINT64, value._unsigned.data());
+        } else {
+            value._kind = AttributeValue::Kind::Integer;
+            value._integers.resize(n_elements);
+            detail::h5a_read(attribute.getId(), H5T_NATIVE_INT64, value._integers.data());
+        }
+        break;
+    case DataTypeClass::Float:
+        value._kind = AttributeValue::Kind::Float;
+        value._floats.resize(n_elements);
+        detail::h5a_read(attribute.getId(), H5T_NATIVE_DOUBLE, value._floats.data());
+        break;
+    case DataTypeClass::String: {
+        value._kind = AttributeValue::Kind::String;
+        value._strings.reserve(n_elements);
+
+        // The file datatype is a suitable memory datatype for strings.
+        if (detail::h5t_is_variable_str(file_type) > 0) {
+            std::vector<char*> buffer(n_elements);
+            detail::h5a_read(attribute.getId(), file_type, buffer.data());
+            for (const char* str: buffer) {
+                value._strings.emplace_back(str == nullptr ? "" : str);
+            }
+#if H5_VERSION_GE(1, 12, 0)
+            detail::h5t_reclaim(file_type, space.getId(), H5P_DEFAULT, buffer.data());
+#else
+            detail::h5d_vlen_reclaim(file_type, space.getId(), H5P_DEFAULT, buffer.data());
+#endif
+        } else {
+            const size_t length = value._datatype.getSize();
+            const bool space_padded = detail::h5t_get_strpad(file_type) == H5T_STR_SPACEPAD;
+            std::vector<char> buffer(n_elements * length);
+            detail::h5a_read(attribute.getId(), file_type, buffer.data());
+            for (size_t i = 0; i < n_elements; ++i) {
+                const char* begin = buffer.data() + i * length;
+                std::string str(begin, std::find(begin, begin + length, '\0'));
+                if (space_padded) {
+                    str.erase(str.find_last_not_of(' ') + 1);
+                }
+                value._strings.push_back(std::move(str));
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    return value;
+}
+
+inline const void* attribute_value_data(const AttributeValue& value,
+                                        std::vector<const char*>& strings) {
+    switch (value._kind) {
+    case AttributeValue::Kind::Integer:
+        return value._integers.data();
+    case AttributeValue::Kind::Unsigned:
+        return value._unsigned.data();
+    case AttributeValue::Kind::Float:
+        return value._floats.data();
+    case AttributeValue::Kind::String:
+        strings.clear();
+        for (const auto& str: value._strings) {
+            strings.push_back(str.c_str());
+        }
+        return strings.data();
+    default:
+        throw DataTypeException("Impossible to write an attribute value of unknown type.");
+    }
+}
+
+}  // namespace detail
+
 }  // namespace HighFive
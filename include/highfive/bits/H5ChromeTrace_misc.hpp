@@ -0,0 +1,152 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+
+#include "../H5ChromeTrace.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+inline void chrome_trace_write_string(std::ostream& os, const std::string& value) {
+    os << '"';
+    for (char c: value) {
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            os << escaped;
+        } else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+// Chrome traces measure time in microseconds, fractions are allowed.
+inline void chrome_trace_write_time(std::ostream& os, std::chrono::nanoseconds time) {
+    auto ns = time.count();
+    auto sign = ns < 0 ? "-" : "";
+    auto abs_ns = ns < 0 ? -ns : ns;
+
+    char buffer[32];
+    std::snprintf(buffer,
+                  sizeof(buffer),
+                  "%s%lld.%03lld",
+                  sign,
+                  static_cast<long long>(abs_ns / 1000),
+                  static_cast<long long>(abs_ns % 1000));
+    os << buffer;
+}
+
+}  // namespace details
+
+inline ChromeTrace::ChromeTrace(int process_id)
+    : _process_id(process_id)
+    , _origin(std::chrono::steady_clock::now())
+    , _epoch_offset(std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::system_clock::now().time_since_epoch())) {}
+
+inline const char* ChromeTrace::getCategory(const char* function) {
+    static const std::pair<const char*, const char*> categories[] = {
+        {"h5d_read", "read"},
+        {"h5a_read", "read"},
+        {"h5d_write", "write"},
+        {"h5a_write", "write"},
+        {"h5d_create2", "create"},
+        {"h5a_create2", "create"},
+        {"h5f_flush", "flush"},
+        {"serialize", "convert"},
+        {"unserialize", "convert"},
+    };
+
+    for (const auto& category: categories) {
+        if (std::strcmp(function, category.first) == 0) {
+            return category.second;
+        }
+    }
+    return nullptr;
+}
+
+inline void ChromeTrace::record(const InstrumentationRecord& record) {
+    const char* category = getCategory(record.function);
+    if (category == nullptr) {
+        return;
+    }
+
+    Event event;
+    event.name = record.function;
+    event.category = category;
+    if (record.object > 0) {
+        event.path = detail::get_instrumented_path(record.object);
+    }
+    event.start = _epoch_offset +
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(record.start - _origin);
+    event.duration = record.duration;
+    event.elements = record.elements;
+    event.bytes = record.bytes;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto thread = _threads.emplace(std::this_thread::get_id(), _threads.size()).first;
+    event.thread = thread->second;
+    _events.push_back(std::move(event));
+}
+
+inline size_t ChromeTrace::size() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _events.size();
+}
+
+inline void ChromeTrace::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _events.clear();
+}
+
+inline void ChromeTrace::write(std::ostream& os) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    os << "{\"traceEvents\":[";
+    for (size_t i = 0; i < _events.size(); ++i) {
+        const auto& event = _events[i];
+        os << (i == 0 ? "\n" : ",\n");
+        os << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category
+           << "\",\"ph\":\"X\",\"ts\":";
+        details::chrome_trace_write_time(os, event.start);
+        os << ",\"dur\":";
+        details::chrome_trace_write_time(os, event.duration);
+        os << ",\"pid\":" << _process_id << ",\"tid\":" << event.thread << ",\"args\":{";
+        if (!event.path.empty()) {
+            os << "\"path\":";
+            details::chrome_trace_write_string(os, event.path);
+            os << ',';
+        }
+        os << "\"elements\":" << event.elements << ",\"bytes\":" << event.bytes << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    if (!os) {
+        throw FileException("Unable to write the trace.");
+    }
+}
+
+inline void ChromeTrace::write(const std::string& filename) const {
+    std::ofstream os(filename, std::ios::trunc);
+    if (!os) {
+        throw FileException("Unable to open '" + filename + "' to write the trace.");
+    }
+    write(os);
+}
+
+}  // namespace HighFive
@@ -8,9 +8,12 @@
  */
 #pragma once
 
+#include <cstring>
 #include <type_traits>
 
 #include "H5Inspector_misc.hpp"
+#include "H5Instrumentation.hpp"
+#include "H5Simd.hpp"
 #include "../H5DataType.hpp"
 
 namespace HighFive {
@@ -88,7 +91,14 @@ struct DeepCopyBuffer {
         return getPointer();
     }
 
+    // Size of the buffer in bytes.
+    size_t getBufferSize() const {
+        return buffer.size() * sizeof(hdf5_type);
+    }
+
     void unserialize(T& val) const {
+        HIGHFIVE_INSTRUMENT_SPAN("unserialize", buffer.size(), getBufferSize());
+        HIGHFIVE_TIME_CONVERSION(UnserializeNs);
         inspector<type>::unserialize(buffer.data(), dims, val);
     }
 
@@ -103,14 +113,35 @@ enum class BufferMode { Read, Write };
 ///
 /// \brief String length in bytes excluding the `\0`.
 ///
+/// Variable length strings have no maximum size, i.e. `size_t(-1)`.
 inline size_t char_buffer_length(char const* const str, size_t max_string_size) {
-    for (size_t i = 0; i < max_string_size; ++i) {
-        if (str[i] == '\0') {
-            return i;
-        }
+    if (max_string_size == size_t(-1)) {
+        return std::strlen(str);
     }
 
-    return max_string_size;
+    const void* end = std::memchr(str, '\0', max_string_size);
+    return end != nullptr ? size_t(static_cast<char const*>(end) - str) : max_string_size;
+}
+
+///
+/// \brief Length in bytes of `str` without the trailing `pad` characters.
+///
+inline size_t trimmed_length(char const* const str, size_t length, char pad) {
+#ifdef HIGHFIVE_SIMD_X86
+    // Compare 16 bytes at a time, starting from the end.
+    const __m128i pads = _mm_set1_epi8(pad);
+    for (; length >= 16; length -= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + length - 16));
+        auto others = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, pads))) ^ 0xffffu;
+        if (others != 0) {
+            return length - 16 + size_t(32 - __builtin_clz(others));
+        }
+    }
+#endif
+    while (length > 0 && str[length - 1] == pad) {
+        --length;
+    }
+    return length;
 }
 
 
@@ -235,6 +266,11 @@ struct StringBuffer {
             }
         }
 
+        /// \brief The padding of the strings in the buffer.
+        StringPadding getPadding() const {
+            return buffer.padding;
+        }
+
       private:
         const StringBuffer<T, buffer_mode>& buffer;
         size_t i;
@@ -315,7 +351,16 @@ struct StringBuffer {
         return Iterator(*this, 0ul);
     }
 
+    // Size of the buffer passed to HDF5 in bytes.
+    size_t getBufferSize() const {
+        return string_size == size_t(-1)
+                   ? variable_length_pointers.size() * sizeof(variable_length_pointers[0])
+                   : fixed_length_buffer.size();
+    }
+
     void unserialize(T& val) {
+        HIGHFIVE_INSTRUMENT_SPAN("unserialize", compute_total_size(dims), getBufferSize());
+        HIGHFIVE_TIME_CONVERSION(UnserializeNs);
         inspector<type>::unserialize(begin(), dims, val);
     }
 
@@ -349,7 +394,9 @@ struct Writer<T, typename enable_shallow_copy<T>::type>: public ShallowCopyBuffe
     explicit Writer(const T& val,
                     const std::vector<size_t>& /* dims */,
                     const DataType& /* file_datatype */)
-        : super(val) {};
+        : super(val) {
+        HIGHFIVE_COUNT_CONVERSION(ShallowCopies, 0);
+    }
 };
 
 template <typename T>
@@ -358,6 +405,9 @@ struct Writer<T, typename enable_deep_copy<T>::type>: public DeepCopyBuffer<T> {
                     const std::vector<size_t>& _dims,
                     const DataType& /* file_datatype */)
         : DeepCopyBuffer<T>(_dims) {
+        HIGHFIVE_COUNT_CONVERSION(DeepCopies, this->getBufferSize());
+        HIGHFIVE_INSTRUMENT_SPAN("serialize", compute_total_size(_dims), this->getBufferSize());
+        HIGHFIVE_TIME_CONVERSION(SerializeNs);
         inspector<T>::serialize(val, _dims, this->begin());
     }
 };
@@ -366,6 +416,9 @@ template <typename T>
 struct Writer<T, typename enable_string_copy<T>::type>: public StringBuffer<T, BufferMode::Write> {
     explicit Writer(const T& val, const std::vector<size_t>& _dims, const DataType& _file_datatype)
         : StringBuffer<T, BufferMode::Write>(_dims, _file_datatype) {
+        HIGHFIVE_COUNT_CONVERSION(StringCopies, this->getBufferSize());
+        HIGHFIVE_INSTRUMENT_SPAN("serialize", compute_total_size(_dims), this->getBufferSize());
+        HIGHFIVE_TIME_CONVERSION(SerializeNs);
         inspector<T>::serialize(val, _dims, this->begin());
     }
 };
@@ -381,7 +434,9 @@ struct Reader<T, typename enable_shallow_copy<T>::type>: public ShallowCopyBuffe
 
   public:
     Reader(const std::vector<size_t>&, type& val, const DataType& /* file_datatype */)
-        : super(val) {}
+        : super(val) {
+        HIGHFIVE_COUNT_CONVERSION(ShallowCopies, 0);
+    }
 };
 
 template <typename T>
@@ -392,7 +447,9 @@ struct Reader<T, typename enable_deep_copy<T>::type>: public DeepCopyBuffer<T> {
 
   public:
     Reader(const std::vector<size_t>& _dims, type&, const DataType& /* file_datatype */)
-        : super(_dims) {}
+        : super(_dims) {
+        HIGHFIVE_COUNT_CONVERSION(DeepCopies, this->getBufferSize());
+    }
 };
 
 
@@ -402,7 +459,9 @@ struct Reader<T, typename enable_string_copy<T>::type>: public StringBuffer<T, B
     explicit Reader(const std::vector<size_t>& _dims,
                     const T& /* val */,
                     const DataType& _file_datatype)
-        : StringBuffer<T, BufferMode::Write>(_dims, _file_datatype) {}
+        : StringBuffer<T, BufferMode::Write>(_dims, _file_datatype) {
+        HIGHFIVE_COUNT_CONVERSION(StringCopies, this->getBufferSize());
+    }
 };
 
 struct data_converter {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <numeric>
 #include <sstream>
@@ -17,7 +18,12 @@
 #include <H5Ppublic.h>
 
 #include "h5d_wrapper.hpp"
+#include "h5p_wrapper.hpp"
+#include "h5s_wrapper.hpp"
 #include "H5Utils.hpp"
+#include "H5ReadWrite_misc.hpp"
+#include "H5Converter_misc.hpp"
+#include "compute_total_size.hpp"
 
 namespace HighFive {
 
@@ -59,4 +65,251 @@ inline void DataSet::resize(const std::vector<size_t>& dims) {
     detail::h5d_set_extent(getId(), real_dims.data());
 }
 
+namespace details {
+
+// Replicate the `n_elements` byte pattern `value` into `buffer`. The number of
+// `memcpy` calls is logarithmic in `n_elements`.
+inline void fill_with_pattern(void* buffer, size_t n_elements, const std::vector<char>& value) {
+    if (n_elements == 0) {
+        return;
+    }
+
+    auto* bytes = static_cast<char*>(buffer);
+    const size_t total = n_elements * value.size();
+
+    bool is_zero = std::all_of(value.begin(), value.end(), [](char c) { return c == 0; });
+    if (is_zero) {
+        std::memset(bytes, 0, total);
+        return;
+    }
+
+    std::memcpy(bytes, value.data(), value.size());
+    size_t filled = value.size();
+    while (filled < total) {
+        size_t n_copy = std::min(filled, total - filled);
+        std::memcpy(bytes + filled, bytes, n_copy);
+        filled += n_copy;
+    }
+}
+
+#if HIGHFIVE_HAS_CHUNK_ITER
+inline int chunk_info_callback(const hsize_t* offset,
+                               unsigned filter_mask,
+                               haddr_t addr,
+                               hsize_t size,
+                               void* op_data) {
+    auto* data = static_cast<std::pair<size_t, std::vector<ChunkInfo>*>*>(op_data);
+    ChunkInfo info;
+    info.offset = std::vector<size_t>(offset, offset + data->first);
+    info.filter_mask = filter_mask;
+    info.address = static_cast<uint64_t>(addr);
+    info.size = static_cast<uint64_t>(size);
+    data->second->push_back(std::move(info));
+
+    return 0;
+}
+#endif
+
+// Without `H5Dchunk_iter` every chunk is looked up by its index, which walks
+// the chunk index up to it, i.e. listing `n` chunks costs `O(n^2)`. Datasets
+// with more chunks aren't listed.
+constexpr size_t max_listed_chunks = 4096;
+
+// Whether listing `n_chunks` allocated chunks is cheap enough.
+inline bool can_list_chunks(size_t n_chunks) {
+    return HIGHFIVE_HAS_CHUNK_ITER || n_chunks <= max_listed_chunks;
+}
+
+// Looking up a chunk by its coordinates searches the chunk index once, at
+// most this many chunks are looked up.
+constexpr size_t max_probed_chunks = 65536;
+
+}  // namespace details
+
+inline size_t DataSet::getNumberAllocatedChunks() const {
+#if H5_VERSION_GE(1, 10, 5)
+    // Some versions of HDF5 reject `H5S_ALL`, the extent with everything
+    // selected is equivalent.
+    hsize_t n_chunks = 0;
+    detail::h5d_get_num_chunks(getId(), getSpace().getId(), &n_chunks);
+    return static_cast<size_t>(n_chunks);
+#else
+    throw DataSetException("Querying allocated chunks requires HDF5 1.10.5 or newer.");
+#endif
+}
+
+inline std::vector<ChunkInfo> DataSet::listAllocatedChunks() const {
+#if H5_VERSION_GE(1, 10, 5)
+    const auto space = getSpace();
+    const size_t rank = space.getNumberDimensions();
+    std::vector<ChunkInfo> chunks;
+
+#if HIGHFIVE_HAS_CHUNK_ITER
+    // A single pass over the chunk index.
+    auto op_data = std::make_pair(rank, &chunks);
+    detail::h5d_chunk_iter(getId(), H5P_DEFAULT, &details::chunk_info_callback, &op_data);
+#else
+    hsize_t n_chunks = 0;
+    detail::h5d_get_num_chunks(getId(), space.getId(), &n_chunks);
+
+    chunks.reserve(static_cast<size_t>(n_chunks));
+    std::vector<hsize_t> offset(rank);
+    for (hsize_t i = 0; i < n_chunks; ++i) {
+        ChunkInfo info;
+        haddr_t addr = HADDR_UNDEF;
+        hsize_t size = 0;
+        detail::h5d_get_chunk_info(
+            getId(), space.getId(), i, offset.data(), &info.filter_mask, &addr, &size);
+
+        info.offset = std::vector<size_t>(offset.begin(), offset.end());
+        info.address = static_cast<uint64_t>(addr);
+        info.size = static_cast<uint64_t>(size);
+        chunks.push_back(std::move(info));
+    }
+#endif
+
+    return chunks;
+#else
+    throw DataSetException("Querying allocated chunks requires HDF5 1.10.5 or newer.");
+#endif
+}
+
+inline HyperSlab DataSet::getAllocatedRegion() const {
+    const auto dims = getDimensions();
+    auto dcpl = getCreatePropertyList();
+
+    if (detail::h5p_get_layout(dcpl.getId()) != H5D_CHUNKED) {
+        if (getStorageSize() == 0 && compute_total_size(dims) != 0) {
+            return HyperSlab();
+        }
+        return HyperSlab(RegularHyperSlab(std::vector<size_t>(dims.size(), 0), dims));
+    }
+
+    const auto chunk_dims = Chunking(dcpl).getDimensions();
+    const size_t rank = dims.size();
+    if (!details::can_list_chunks(getNumberAllocatedChunks())) {
+        return HyperSlab(RegularHyperSlab(std::vector<size_t>(rank, 0), dims));
+    }
+
+    // Chunks which follow each other along the last dimension are merged into
+    // one block, since every block makes the selection more expensive.
+    HyperSlab region;
+    std::vector<size_t> offset;
+    std::vector<size_t> count;
+    std::vector<size_t> chunk_count(rank);
+    auto is_continued_by = [&](const std::vector<size_t>& next_offset) {
+        for (size_t i = 0; i + 1 < rank; ++i) {
+            if (next_offset[i] != offset[i] || chunk_count[i] != count[i]) {
+                return false;
+            }
+        }
+        return rank != 0 && next_offset[rank - 1] == offset[rank - 1] + count[rank - 1];
+    };
+
+    for (const auto& chunk: listAllocatedChunks()) {
+        for (size_t i = 0; i < rank; ++i) {
+            // Chunks on the boundary can extend past the current extent.
+            chunk_count[i] = chunk.offset[i] < dims[i]
+                                 ? std::min(static_cast<size_t>(chunk_dims[i]),
+                                            dims[i] - chunk.offset[i])
+                                 : 0;
+        }
+
+        if (compute_total_size(chunk_count) == 0) {
+            continue;
+        }
+
+        if (!offset.empty() && is_continued_by(chunk.offset)) {
+            count[rank - 1] += chunk_count[rank - 1];
+        } else {
+            if (!offset.empty()) {
+                region |= RegularHyperSlab(offset, count);
+            }
+            offset = chunk.offset;
+            count = chunk_count;
+        }
+    }
+
+    if (!offset.empty()) {
+        region |= RegularHyperSlab(offset, count);
+    }
+
+    return region;
+}
+
+template <typename T>
+inline T DataSet::readSparse(const DataTransferProps& xfer_props) const {
+    T array;
+    readSparse(array, xfer_props);
+    return array;
+}
+
+template <typename T>
+inline void DataSet::readSparse(T& array, const DataTransferProps& xfer_props) const {
+#if H5_VERSION_GE(1, 10, 5)
+    auto dcpl = getCreatePropertyList();
+    if (detail::h5p_get_layout(dcpl.getId()) != H5D_CHUNKED) {
+        read(array, xfer_props);
+        return;
+    }
+
+    H5D_fill_value_t fill_status;
+    detail::h5p_fill_value_defined(dcpl.getId(), &fill_status);
+
+    auto file_datatype = getDataType();
+    const details::BufferInfo<T> buffer_info(
+        file_datatype,
+        [this]() -> std::string { return this->getPath(); },
+        details::BufferInfo<T>::Operation::read);
+
+    const auto& mem_datatype = buffer_info.data_type;
+    auto c = mem_datatype.getClass();
+    if (fill_status == H5D_FILL_VALUE_UNDEFINED || c == DataTypeClass::String ||
+        c == DataTypeClass::VarLen || c == DataTypeClass::Reference) {
+        read(array, xfer_props);
+        return;
+    }
+
+    // Without the list of chunks, the allocated region is the whole dataset.
+    if (!details::can_list_chunks(getNumberAllocatedChunks())) {
+        read(array, xfer_props);
+        return;
+    }
+
+    const DataSpace mem_space = getMemSpace();
+    if (!details::checkDimensions(mem_space, buffer_info.getMinRank(), buffer_info.getMaxRank())) {
+        std::ostringstream ss;
+        ss << "Impossible to read DataSet of dimensions " << mem_space.getNumberDimensions()
+           << " into arrays of dimensions: " << buffer_info.getMinRank() << "(min) to "
+           << buffer_info.getMaxRank() << "(max)";
+        throw DataSpaceException(ss.str());
+    }
+
+    auto dims = mem_space.getDimensions();
+    auto r = details::data_converter::get_reader<T>(dims, array, file_datatype);
+
+    std::vector<char> fill_value(mem_datatype.getSize());
+    detail::h5p_get_fill_value(dcpl.getId(), mem_datatype.getId(), fill_value.data());
+    details::fill_with_pattern(r.getPointer(), compute_total_size(dims), fill_value);
+
+    // Both dataspaces have the same shape, hence selecting the same region in
+    // both places every element read at the right offset in memory.
+    auto region = getAllocatedRegion();
+    auto file_space = region.apply(getSpace());
+    if (detail::h5s_get_select_npoints(file_space.getId()) != 0) {
+        auto region_mem_space = region.apply(mem_space);
+        detail::h5d_read(getId(),
+                         mem_datatype.getId(),
+                         region_mem_space.getId(),
+                         file_space.getId(),
+                         xfer_props.getId(),
+                         static_cast<void*>(r.getPointer()));
+    }
+
+    r.unserialize(array);
+#else
+    read(array, xfer_props);
+#endif
+}
+
 }  // namespace HighFive
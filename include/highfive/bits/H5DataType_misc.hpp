@@ -183,6 +183,29 @@ inline AtomicType<long double>::AtomicType() {
     _hid = detail::h5t_copy(H5T_NATIVE_LDOUBLE);
 }
 
+namespace details {
+// IEEE 754 half precision, in the byte order of `float`. See `half_float.hpp`.
+inline hid_t create_float16_datatype() {
+    hid_t hid = detail::h5t_copy(H5T_NATIVE_FLOAT);
+    // Sign position, exponent position, exponent size, mantissa position, mantissa size
+    detail::h5t_set_fields(hid, 15, 10, 5, 0, 10);
+    // Total datatype size (in bytes)
+    detail::h5t_set_size(hid, 2);
+    // Floating point exponent bias
+    detail::h5t_set_ebias(hid, 15);
+    return hid;
+}
+
+// The upper half of an IEEE 754 single precision float. See `bfloat16.hpp`.
+inline hid_t create_bfloat16_datatype() {
+    hid_t hid = detail::h5t_copy(H5T_NATIVE_FLOAT);
+    detail::h5t_set_fields(hid, 15, 7, 8, 0, 7);
+    detail::h5t_set_size(hid, 2);
+    detail::h5t_set_ebias(hid, 127);
+    return hid;
+}
+}  // namespace details
+
 // std string
 template <>
 inline AtomicType<std::string>::AtomicType() {
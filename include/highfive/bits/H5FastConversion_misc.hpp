@@ -0,0 +1,1086 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <H5Dpublic.h>
+#include <H5Ppublic.h>
+#include <H5Spublic.h>
+#include <H5Tpublic.h>
+
+#include "../H5FastConversion.hpp"
+#include "../bfloat16.hpp"
+#include "H5Simd.hpp"
+#include "h5d_wrapper.hpp"
+#include "h5t_wrapper.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// Kernels convert `n` contiguous elements from `src` to `dst`, which must not
+// overlap. The byte swaps work in place.
+using fast_convert_kernel = void (*)(const void* src, void* dst, size_t n);
+using fast_swap_kernel = void (*)(void* data, size_t n);
+
+struct FastConversionKernels {
+    fast_convert_kernel i16_f64;
+    fast_convert_kernel i32_f64;
+    fast_convert_kernel f32_f64;
+    fast_convert_kernel f64_f32;
+    fast_convert_kernel f16_f32;
+    fast_convert_kernel f32_f16;
+    fast_convert_kernel bf16_f32;
+    fast_convert_kernel f32_bf16;
+    fast_swap_kernel swap16;
+    fast_swap_kernel swap32;
+    fast_swap_kernel swap64;
+};
+
+// HDF5 converts values outside the range of `float` to infinity, even if they
+// would be rounded to `FLT_MAX`.
+inline float fast_double_to_float(double value) {
+    const double max = static_cast<double>(std::numeric_limits<float>::max());
+    if (value > max) {
+        return std::numeric_limits<float>::infinity();
+    }
+    if (value < -max) {
+        return -std::numeric_limits<float>::infinity();
+    }
+    return static_cast<float>(value);
+}
+
+template <class From, class To>
+inline To fast_convert_value(From value) {
+    return static_cast<To>(value);
+}
+
+template <>
+inline float fast_convert_value<double, float>(double value) {
+    return fast_double_to_float(value);
+}
+
+// The bits of an IEEE 754 half precision float, see `create_float16_datatype`.
+struct float16_bits {
+    uint16_t bits;
+};
+
+// Rounds to nearest even, like F16C and `half_float::half`. HDF5's soft
+// conversion truncates subnormal values and doesn't preserve NaN payloads.
+inline float16_bits float_to_float16(float value) {
+    uint32_t x;
+    std::memcpy(&x, &value, sizeof(x));
+    const auto sign = static_cast<uint16_t>((x >> 16) & 0x8000u);
+    uint32_t abs = x & 0x7fffffffu;
+
+    // Infinity, NaN and values which round to infinity.
+    if (abs >= 0x47800000u) {
+        uint32_t nan = abs > 0x7f800000u ? 0x7e00u | ((abs >> 13) & 0x3ffu) : 0x7c00u;
+        return {static_cast<uint16_t>(sign | nan)};
+    }
+
+    // Subnormal halves, the addition rounds the mantissa into place.
+    if (abs < 0x38800000u) {
+        float shifted;
+        std::memcpy(&shifted, &abs, sizeof(shifted));
+        shifted += 0.5f;
+        std::memcpy(&abs, &shifted, sizeof(abs));
+        return {static_cast<uint16_t>(sign | (abs - 0x3f000000u))};
+    }
+
+    const uint32_t odd = (abs >> 13) & 1u;
+    abs = abs - (112u << 23) + 0xfffu + odd;
+    return {static_cast<uint16_t>(sign | (abs >> 13))};
+}
+
+inline float float16_to_float(float16_bits value) {
+    const uint32_t sign = uint32_t(value.bits & 0x8000u) << 16;
+    const uint32_t abs = value.bits & 0x7fffu;
+
+    uint32_t x;
+    if (abs >= 0x7c00u) {
+        // Infinity and NaN, NaNs are quieted.
+        x = 0x7f800000u | ((abs & 0x3ffu) << 13) | (abs > 0x7c00u ? 0x400000u : 0u);
+    } else if (abs >= 0x0400u) {
+        x = (abs << 13) + (112u << 23);
+    } else {
+        // Subnormal, the value is `abs * 2^-24`.
+        float subnormal = static_cast<float>(abs) * 5.9604644775390625e-8f;
+        std::memcpy(&x, &subnormal, sizeof(x));
+    }
+    x |= sign;
+
+    float result;
+    std::memcpy(&result, &x, sizeof(result));
+    return result;
+}
+
+template <>
+inline float fast_convert_value<float16_bits, float>(float16_bits value) {
+    return float16_to_float(value);
+}
+
+template <>
+inline float16_bits fast_convert_value<float, float16_bits>(float value) {
+    return float_to_float16(value);
+}
+
+template <class From, class To>
+inline void fast_convert_scalar(const void* src, void* dst, size_t n) {
+    auto s = static_cast<const unsigned char*>(src);
+    auto d = static_cast<unsigned char*>(dst);
+    for (size_t i = 0; i < n; ++i) {
+        From value;
+        std::memcpy(&value, s + i * sizeof(From), sizeof(From));
+        To converted = fast_convert_value<From, To>(value);
+        std::memcpy(d + i * sizeof(To), &converted, sizeof(To));
+    }
+}
+
+// Compilers recognize these as a single instruction.
+inline uint16_t fast_byte_swap(uint16_t v) {
+    return static_cast<uint16_t>((v >> 8) | (v << 8));
+}
+
+inline uint32_t fast_byte_swap(uint32_t v) {
+    return (v >> 24) | ((v >> 8) & 0xff00u) | ((v << 8) & 0xff0000u) | (v << 24);
+}
+
+inline uint64_t fast_byte_swap(uint64_t v) {
+    return (uint64_t(fast_byte_swap(uint32_t(v))) << 32) | fast_byte_swap(uint32_t(v >> 32));
+}
+
+template <size_t N>
+struct fast_swap_word;
+
+template <>
+struct fast_swap_word<2> {
+    using type = uint16_t;
+};
+
+template <>
+struct fast_swap_word<4> {
+    using type = uint32_t;
+};
+
+template <>
+struct fast_swap_word<8> {
+    using type = uint64_t;
+};
+
+template <size_t N>
+inline void fast_swap_scalar(void* data, size_t n) {
+    auto bytes = static_cast<unsigned char*>(data);
+    for (size_t i = 0; i < n; ++i) {
+        typename fast_swap_word<N>::type word;
+        std::memcpy(&word, bytes + i * N, N);
+        word = fast_byte_swap(word);
+        std::memcpy(bytes + i * N, &word, N);
+    }
+}
+
+#ifdef HIGHFIVE_SIMD_X86
+
+inline void fast_convert_i16_f64_sse2(const void* src, void* dst, size_t n) {
+    auto s = static_cast<const int16_t*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        _mm_storeu_pd(d + i, _mm_cvtepi32_pd(lo));
+        _mm_storeu_pd(d + i + 2, _mm_cvtepi32_pd(_mm_shuffle_epi32(lo, 0xee)));
+        _mm_storeu_pd(d + i + 4, _mm_cvtepi32_pd(hi));
+        _mm_storeu_pd(d + i + 6, _mm_cvtepi32_pd(_mm_shuffle_epi32(hi, 0xee)));
+    }
+    fast_convert_scalar<int16_t, double>(s + i, d + i, n - i);
+}
+
+inline void fast_convert_i32_f64_sse2(const void* src, void* dst, size_t n) {
+    auto s = static_cast<const int32_t*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm_storeu_pd(d + i, _mm_cvtepi32_pd(v));
+        _mm_storeu_pd(d + i + 2, _mm_cvtepi32_pd(_mm_shuffle_epi32(v, 0xee)));
+    }
+    fast_convert_scalar<int32_t, double>(s + i, d + i, n - i);
+}
+
+inline void fast_convert_f32_f64_sse2(const void* src, void* dst, size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 v = _mm_loadu_ps(s + i);
+        _mm_storeu_pd(d + i, _mm_cvtps_pd(v));
+        _mm_storeu_pd(d + i + 2, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+    fast_convert_scalar<float, double>(s + i, d + i, n - i);
+}
+
+// Values outside the range of `float` are doubled, such that they can't be
+// rounded to `FLT_MAX`, see `fast_double_to_float`.
+inline __m128 fast_double_to_float_sse2(__m128d v) {
+    const __m128d max = _mm_set1_pd(static_cast<double>(std::numeric_limits<float>::max()));
+    __m128d out_of_range = _mm_cmpgt_pd(_mm_andnot_pd(_mm_set1_pd(-0.0), v), max);
+    v = _mm_or_pd(_mm_and_pd(out_of_range, _mm_add_pd(v, v)), _mm_andnot_pd(out_of_range, v));
+    return _mm_cvtpd_ps(v);
+}
+
+inline void fast_convert_f64_f32_sse2(const void* src, void* dst, size_t n) {
+    auto s = static_cast<const double*>(src);
+    auto d = static_cast<float*>(dst);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 lo = fast_double_to_float_sse2(_mm_loadu_pd(s + i));
+        __m128 hi = fast_double_to_float_sse2(_mm_loadu_pd(s + i + 2));
+        _mm_storeu_ps(d + i, _mm_movelh_ps(lo, hi));
+    }
+    fast_convert_scalar<double, float>(s + i, d + i, n - i);
+}
+
+inline void fast_convert_bf16_f32_sse2(const void* src, void* dst, size_t n) {
+    auto s = static_cast<const uint16_t*>(src);
+    auto d = static_cast<float*>(dst);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), _mm_unpacklo_epi16(zero, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i + 4), _mm_unpackhi_epi16(zero, v));
+    }
+    fast_convert_scalar<bfloat16_t, float>(s + i, d + i, n - i);
+}
+
+// Rounds the bits of four floats like `bfloat16_t(float)`. The result is
+// sign extended, such that it can be packed with signed saturation.
+inline __m128i fast_float_to_bfloat16_sse2(__m128i x) {
+    __m128i nan = _mm_cmpgt_epi32(_mm_and_si128(x, _mm_set1_epi32(0x7fffffff)),
+                                  _mm_set1_epi32(0x7f800000));
+    __m128i odd = _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(1));
+    __m128i rounded = _mm_add_epi32(x, _mm_add_epi32(odd, _mm_set1_epi32(0x7fff)));
+    __m128i quiet = _mm_or_si128(x, _mm_set1_epi32(0x400000));
+    x = _mm_or_si128(_mm_and_si128(nan, quiet), _mm_andnot_si128(nan, rounded));
+    return _mm_srai_epi32(x, 16);
+}
+
+inline void fast_convert_f32_bf16_sse2(const void* src, void* dst, size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<uint16_t*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + 4));
+        __m128i v = _mm_packs_epi32(fast_float_to_bfloat16_sse2(lo),
+                                    fast_float_to_bfloat16_sse2(hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), v);
+    }
+    fast_convert_scalar<float, bfloat16_t>(s + i, d + i, n - i);
+}
+
+inline __m128i fast_swap16_lanes_sse2(__m128i v) {
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+inline void fast_swap16_sse2(void* data, size_t n) {
+    auto p = static_cast<int16_t*>(data);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        auto addr = reinterpret_cast<__m128i*>(p + i);
+        _mm_storeu_si128(addr, fast_swap16_lanes_sse2(_mm_loadu_si128(addr)));
+    }
+    fast_swap_scalar<2>(p + i, n - i);
+}
+
+inline void fast_swap32_sse2(void* data, size_t n) {
+    auto p = static_cast<int32_t*>(data);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        auto addr = reinterpret_cast<__m128i*>(p + i);
+        __m128i v = _mm_loadu_si128(addr);
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);
+        _mm_storeu_si128(addr, fast_swap16_lanes_sse2(v));
+    }
+    fast_swap_scalar<4>(p + i, n - i);
+}
+
+inline void fast_swap64_sse2(void* data, size_t n) {
+    auto p = static_cast<int64_t*>(data);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        auto addr = reinterpret_cast<__m128i*>(p + i);
+        __m128i v = _mm_loadu_si128(addr);
+        v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1b), 0x1b);
+        _mm_storeu_si128(addr, fast_swap16_lanes_sse2(v));
+    }
+    fast_swap_scalar<8>(p + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void fast_convert_i16_f64_avx2(const void* src,
+                                                                     void* dst,
+                                                                     size_t n) {
+    auto s = static_cast<const int16_t*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_cvtepi16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)));
+        _mm256_storeu_pd(d + i, _mm256_cvtepi32_pd(_mm256_castsi256_si128(v)));
+        _mm256_storeu_pd(d + i + 4, _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1)));
+    }
+    fast_convert_scalar<int16_t, double>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void fast_convert_i32_f64_avx2(const void* src,
+                                                                     void* dst,
+                                                                     size_t n) {
+    auto s = static_cast<const int32_t*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm256_storeu_pd(d + i, _mm256_cvtepi32_pd(v));
+    }
+    fast_convert_scalar<int32_t, double>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void fast_convert_f32_f64_avx2(const void* src,
+                                                                     void* dst,
+                                                                     size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(d + i, _mm256_cvtps_pd(_mm_loadu_ps(s + i)));
+    }
+    fast_convert_scalar<float, double>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void fast_convert_f64_f32_avx2(const void* src,
+                                                                     void* dst,
+                                                                     size_t n) {
+    auto s = static_cast<const double*>(src);
+    auto d = static_cast<float*>(dst);
+    const __m256d max = _mm256_set1_pd(static_cast<double>(std::numeric_limits<float>::max()));
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_loadu_pd(s + i);
+        __m256d out_of_range = _mm256_cmp_pd(_mm256_andnot_pd(sign, v), max, _CMP_GT_OQ);
+        v = _mm256_blendv_pd(v, _mm256_add_pd(v, v), out_of_range);
+        _mm_storeu_ps(d + i, _mm256_cvtpd_ps(v));
+    }
+    fast_convert_scalar<double, float>(s + i, d + i, n - i);
+}
+
+template <size_t N>
+__attribute__((target("avx2"))) inline void fast_swap_avx2(void* data, size_t n) {
+    // Reverses the bytes of every element of size `N` within each 128-bit lane.
+    alignas(32) char mask[32];
+    for (size_t k = 0; k < 32; ++k) {
+        mask[k] = static_cast<char>((k / N) * N + (N - 1 - k % N));
+    }
+    const __m256i shuffle = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask));
+
+    auto bytes = static_cast<unsigned char*>(data);
+    size_t i = 0;
+    for (; (i + 32 / N) <= n; i += 32 / N) {
+        auto addr = reinterpret_cast<__m256i*>(bytes + i * N);
+        _mm256_storeu_si256(addr, _mm256_shuffle_epi8(_mm256_loadu_si256(addr), shuffle));
+    }
+    fast_swap_scalar<N>(bytes + i * N, n - i);
+}
+
+__attribute__((target("avx,f16c"))) inline void fast_convert_f16_f32_f16c(const void* src,
+                                                                        void* dst,
+                                                                        size_t n) {
+    auto s = static_cast<const uint16_t*>(src);
+    auto d = static_cast<float*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm256_storeu_ps(d + i, _mm256_cvtph_ps(v));
+    }
+    fast_convert_scalar<float16_bits, float>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx,f16c"))) inline void fast_convert_f32_f16_f16c(const void* src,
+                                                                        void* dst,
+                                                                        size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<uint16_t*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i v = _mm256_cvtps_ph(_mm256_loadu_ps(s + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), v);
+    }
+    fast_convert_scalar<float, float16_bits>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void fast_convert_bf16_f32_avx2(const void* src,
+                                                                      void* dst,
+                                                                      size_t n) {
+    auto s = static_cast<const uint16_t*>(src);
+    auto d = static_cast<float*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_cvtepu16_epi32(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), _mm256_slli_epi32(v, 16));
+    }
+    fast_convert_scalar<bfloat16_t, float>(s + i, d + i, n - i);
+}
+
+// See `fast_float_to_bfloat16_sse2`.
+__attribute__((target("avx2"))) inline __m256i fast_float_to_bfloat16_avx2(__m256i x) {
+    __m256i nan = _mm256_cmpgt_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7fffffff)),
+                                     _mm256_set1_epi32(0x7f800000));
+    __m256i odd = _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+    __m256i rounded = _mm256_add_epi32(x, _mm256_add_epi32(odd, _mm256_set1_epi32(0x7fff)));
+    __m256i quiet = _mm256_or_si256(x, _mm256_set1_epi32(0x400000));
+    return _mm256_srai_epi32(_mm256_blendv_epi8(rounded, quiet, nan), 16);
+}
+
+__attribute__((target("avx2"))) inline void fast_convert_f32_bf16_avx2(const void* src,
+                                                                      void* dst,
+                                                                      size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<uint16_t*>(dst);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + 8));
+        // Packing interleaves the 128-bit lanes of `lo` and `hi`, restore the order.
+        __m256i v = _mm256_packs_epi32(fast_float_to_bfloat16_avx2(lo),
+                                       fast_float_to_bfloat16_avx2(hi));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), _mm256_permute4x64_epi64(v, 0xd8));
+    }
+    fast_convert_scalar<float, bfloat16_t>(s + i, d + i, n - i);
+}
+
+// GCC 12 warns about the undefined registers used by some AVX-512 intrinsics.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f"))) inline void fast_convert_i16_f64_avx512(const void* src,
+                                                                         void* dst,
+                                                                         size_t n) {
+    auto s = static_cast<const int16_t*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i v = _mm512_cvtepi16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i)));
+        _mm512_storeu_pd(d + i, _mm512_cvtepi32_pd(_mm512_castsi512_si256(v)));
+        _mm512_storeu_pd(d + i + 8, _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(v, 1)));
+    }
+    fast_convert_scalar<int16_t, double>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx512f"))) inline void fast_convert_i32_f64_avx512(const void* src,
+                                                                         void* dst,
+                                                                         size_t n) {
+    auto s = static_cast<const int32_t*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        _mm512_storeu_pd(d + i, _mm512_cvtepi32_pd(v));
+    }
+    fast_convert_scalar<int32_t, double>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx512f"))) inline void fast_convert_f32_f64_avx512(const void* src,
+                                                                         void* dst,
+                                                                         size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<double*>(dst);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(d + i, _mm512_cvtps_pd(_mm256_loadu_ps(s + i)));
+    }
+    fast_convert_scalar<float, double>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx512f"))) inline void fast_convert_f64_f32_avx512(const void* src,
+                                                                         void* dst,
+                                                                         size_t n) {
+    auto s = static_cast<const double*>(src);
+    auto d = static_cast<float*>(dst);
+    const __m512d max = _mm512_set1_pd(static_cast<double>(std::numeric_limits<float>::max()));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m512d v = _mm512_loadu_pd(s + i);
+        __mmask8 out_of_range = _mm512_cmp_pd_mask(_mm512_abs_pd(v), max, _CMP_GT_OQ);
+        v = _mm512_mask_add_pd(v, out_of_range, v, v);
+        _mm256_storeu_ps(d + i, _mm512_cvtpd_ps(v));
+    }
+    fast_convert_scalar<double, float>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx512f"))) inline void fast_convert_f16_f32_avx512(const void* src,
+                                                                         void* dst,
+                                                                         size_t n) {
+    auto s = static_cast<const uint16_t*>(src);
+    auto d = static_cast<float*>(dst);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        _mm512_storeu_ps(d + i, _mm512_cvtph_ps(v));
+    }
+    fast_convert_scalar<float16_bits, float>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx512f"))) inline void fast_convert_f32_f16_avx512(const void* src,
+                                                                         void* dst,
+                                                                         size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<uint16_t*>(dst);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        // Unlike `_mm512_cvtps_ph`, the masked version doesn't trigger -Wsign-conversion.
+        __m256i v = _mm512_maskz_cvtps_ph(0xffff,
+                                          _mm512_loadu_ps(s + i),
+                                          _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), v);
+    }
+    fast_convert_scalar<float, float16_bits>(s + i, d + i, n - i);
+}
+
+__attribute__((target("avx512f"))) inline void fast_convert_bf16_f32_avx512(const void* src,
+                                                                          void* dst,
+                                                                          size_t n) {
+    auto s = static_cast<const uint16_t*>(src);
+    auto d = static_cast<float*>(dst);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i v = _mm512_cvtepu16_epi32(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i)));
+        _mm512_storeu_si512(d + i, _mm512_slli_epi32(v, 16));
+    }
+    fast_convert_scalar<bfloat16_t, float>(s + i, d + i, n - i);
+}
+
+// AVX512_BF16 would convert in one instruction, but it flushes subnormal
+// values to zero. Rounds like `fast_float_to_bfloat16_sse2`.
+__attribute__((target("avx512f"))) inline void fast_convert_f32_bf16_avx512(const void* src,
+                                                                          void* dst,
+                                                                          size_t n) {
+    auto s = static_cast<const float*>(src);
+    auto d = static_cast<uint16_t*>(dst);
+    const __m512i abs_mask = _mm512_set1_epi32(0x7fffffff);
+    const __m512i inf = _mm512_set1_epi32(0x7f800000);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i x = _mm512_loadu_si512(s + i);
+        __mmask16 nan = _mm512_cmpgt_epi32_mask(_mm512_and_si512(x, abs_mask), inf);
+        __m512i odd = _mm512_and_si512(_mm512_srli_epi32(x, 16), _mm512_set1_epi32(1));
+        __m512i rounded = _mm512_add_epi32(x, _mm512_add_epi32(odd, _mm512_set1_epi32(0x7fff)));
+        __m512i quiet = _mm512_or_si512(x, _mm512_set1_epi32(0x400000));
+        x = _mm512_srli_epi32(_mm512_mask_blend_epi32(nan, rounded, quiet), 16);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), _mm512_cvtepi32_epi16(x));
+    }
+    fast_convert_scalar<float, bfloat16_t>(s + i, d + i, n - i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+inline const FastConversionKernels& get_fast_conversion_kernels(SimdLevel level) {
+    static const FastConversionKernels scalar = {fast_convert_scalar<int16_t, double>,
+                                                 fast_convert_scalar<int32_t, double>,
+                                                 fast_convert_scalar<float, double>,
+                                                 fast_convert_scalar<double, float>,
+                                                 fast_convert_scalar<float16_bits, float>,
+                                                 fast_convert_scalar<float, float16_bits>,
+                                                 fast_convert_scalar<bfloat16_t, float>,
+                                                 fast_convert_scalar<float, bfloat16_t>,
+                                                 fast_swap_scalar<2>,
+                                                 fast_swap_scalar<4>,
+                                                 fast_swap_scalar<8>};
+#ifdef HIGHFIVE_SIMD_X86
+    // SSE2 has no instructions for half precision floats, bfloat16 only needs
+    // integer instructions.
+    static const FastConversionKernels sse2 = {fast_convert_i16_f64_sse2,
+                                               fast_convert_i32_f64_sse2,
+                                               fast_convert_f32_f64_sse2,
+                                               fast_convert_f64_f32_sse2,
+                                               fast_convert_scalar<float16_bits, float>,
+                                               fast_convert_scalar<float, float16_bits>,
+                                               fast_convert_bf16_f32_sse2,
+                                               fast_convert_f32_bf16_sse2,
+                                               fast_swap16_sse2,
+                                               fast_swap32_sse2,
+                                               fast_swap64_sse2};
+    // F16C isn't part of AVX2, it's checked separately.
+    static const bool has_f16c = cpu_supports_f16c();
+    static const FastConversionKernels avx2 = {
+        fast_convert_i16_f64_avx2,
+        fast_convert_i32_f64_avx2,
+        fast_convert_f32_f64_avx2,
+        fast_convert_f64_f32_avx2,
+        has_f16c ? fast_convert_kernel(fast_convert_f16_f32_f16c)
+                 : fast_convert_kernel(fast_convert_scalar<float16_bits, float>),
+        has_f16c ? fast_convert_kernel(fast_convert_f32_f16_f16c)
+                 : fast_convert_kernel(fast_convert_scalar<float, float16_bits>),
+        fast_convert_bf16_f32_avx2,
+        fast_convert_f32_bf16_avx2,
+        fast_swap_avx2<2>,
+        fast_swap_avx2<4>,
+        fast_swap_avx2<8>};
+    // Shuffling bytes in 512-bit registers requires AVX-512BW, the swaps use AVX2.
+    static const FastConversionKernels avx512 = {fast_convert_i16_f64_avx512,
+                                                 fast_convert_i32_f64_avx512,
+                                                 fast_convert_f32_f64_avx512,
+                                                 fast_convert_f64_f32_avx512,
+                                                 fast_convert_f16_f32_avx512,
+                                                 fast_convert_f32_f16_avx512,
+                                                 fast_convert_bf16_f32_avx512,
+                                                 fast_convert_f32_bf16_avx512,
+                                                 fast_swap_avx2<2>,
+                                                 fast_swap_avx2<4>,
+                                                 fast_swap_avx2<8>};
+
+    switch (level) {
+    case SimdLevel::SSE2:
+        return sse2;
+    case SimdLevel::AVX2:
+        return avx2;
+    case SimdLevel::AVX512:
+        return avx512;
+    default:
+        return scalar;
+    }
+#else
+    (void) level;
+    return scalar;
+#endif
+}
+
+inline std::atomic<SimdLevel>& fast_conversion_level() {
+    static std::atomic<SimdLevel> level{SimdLevel::Scalar};
+    return level;
+}
+
+inline std::atomic<bool>& fast_conversions_registered() {
+    static std::atomic<bool> registered{false};
+    return registered;
+}
+
+// Byte swaps don't need a conversion kernel.
+template <class From, class To>
+struct fast_convert_kernel_of {
+    static fast_convert_kernel get(const FastConversionKernels&) {
+        return nullptr;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<int16_t, double> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.i16_f64;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<int32_t, double> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.i32_f64;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<float, double> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.f32_f64;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<double, float> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.f64_f32;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<float16_bits, float> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.f16_f32;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<float, float16_bits> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.f32_f16;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<bfloat16_t, float> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.bf16_f32;
+    }
+};
+
+template <>
+struct fast_convert_kernel_of<float, bfloat16_t> {
+    static fast_convert_kernel get(const FastConversionKernels& kernels) {
+        return kernels.f32_bf16;
+    }
+};
+
+inline fast_swap_kernel get_fast_swap_kernel(const FastConversionKernels& kernels, size_t size) {
+    return size == 2 ? kernels.swap16 : size == 4 ? kernels.swap32 : kernels.swap64;
+}
+
+// Only `double` to `float` and `float` to `float16` or `bfloat16` can raise
+// exceptions, i.e. overflow.
+template <class From, class To>
+inline bool fast_conversion_overflows(From, H5T_conv_except_t&) {
+    return false;
+}
+
+template <>
+inline bool fast_conversion_overflows<double, float>(double value, H5T_conv_except_t& except) {
+    const double max = static_cast<double>(std::numeric_limits<float>::max());
+    except = value > max ? H5T_CONV_EXCEPT_RANGE_HI : H5T_CONV_EXCEPT_RANGE_LOW;
+    return value > max || value < -max;
+}
+
+template <>
+inline bool fast_conversion_overflows<float, float16_bits>(float value,
+                                                           H5T_conv_except_t& except) {
+    // Finite values from `65520` on are rounded to infinity.
+    except = value > 0.0f ? H5T_CONV_EXCEPT_RANGE_HI : H5T_CONV_EXCEPT_RANGE_LOW;
+    return std::abs(value) >= 65520.0f && std::abs(value) <= std::numeric_limits<float>::max();
+}
+
+template <>
+inline bool fast_conversion_overflows<float, bfloat16_t>(float value, H5T_conv_except_t& except) {
+    // Finite values from halfway between the largest `bfloat16` and infinity.
+    uint32_t x;
+    std::memcpy(&x, &value, sizeof(x));
+    except = value > 0.0f ? H5T_CONV_EXCEPT_RANGE_HI : H5T_CONV_EXCEPT_RANGE_LOW;
+    return (x & 0x7fffffffu) >= 0x7f7f8000u && (x & 0x7fffffffu) < 0x7f800000u;
+}
+
+// Converts one element at a time. Used for strided buffers, e.g. members of
+// compound types, and to call the exception callback.
+template <class From, class To, bool SwapFrom, bool SwapTo>
+inline herr_t fast_convert_elements(hid_t src_id,
+                                    hid_t dst_id,
+                                    unsigned char* buf,
+                                    size_t n,
+                                    size_t stride,
+                                    H5T_conv_except_func_t except_func,
+                                    void* except_data) {
+    const size_t src_stride = stride != 0 ? stride : sizeof(From);
+    const size_t dst_stride = stride != 0 ? stride : sizeof(To);
+    const bool backwards = sizeof(To) > sizeof(From);
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t i = backwards ? n - 1 - k : k;
+        unsigned char* src = buf + i * src_stride;
+        unsigned char* dst = buf + i * dst_stride;
+
+        unsigned char original[sizeof(From)];
+        std::memcpy(original, src, sizeof(From));
+        From value;
+        std::memcpy(&value, src, sizeof(From));
+        if (SwapFrom) {
+            fast_swap_scalar<sizeof(From)>(&value, 1);
+        }
+
+        To converted;
+        H5T_conv_except_t except = H5T_CONV_EXCEPT_RANGE_HI;
+        auto status = H5T_CONV_UNHANDLED;
+        if (except_func != nullptr && fast_conversion_overflows<From, To>(value, except)) {
+            status = except_func(except, src_id, dst_id, original, &converted, except_data);
+        }
+
+        if (status == H5T_CONV_ABORT) {
+            return -1;
+        }
+        if (status == H5T_CONV_UNHANDLED) {
+            converted = fast_convert_value<From, To>(value);
+            if (SwapTo) {
+                fast_swap_scalar<sizeof(To)>(&converted, 1);
+            }
+        }
+        std::memcpy(dst, &converted, sizeof(To));
+    }
+
+    return 0;
+}
+
+// A conversion function, see `H5T_conv_t`. The conversion happens in place,
+// in blocks which are copied to a temporary buffer first. Conversions to
+// larger types start with the last block, such that no unconverted element
+// is overwritten.
+template <class From, class To, bool SwapFrom, bool SwapTo>
+inline herr_t fast_conversion(hid_t src_id,
+                              hid_t dst_id,
+                              H5T_cdata_t* cdata,
+                              size_t n_elements,
+                              size_t buf_stride,
+                              size_t /* bkg_stride */,
+                              void* buf,
+                              void* /* bkg */,
+                              hid_t dxpl_id) {
+    switch (cdata->command) {
+    case H5T_CONV_INIT:
+        cdata->need_bkg = H5T_BKG_NO;
+        return 0;
+    case H5T_CONV_FREE:
+        return 0;
+    case H5T_CONV_CONV:
+        break;
+    default:
+        return -1;
+    }
+
+    H5T_conv_except_func_t except_func = nullptr;
+    void* except_data = nullptr;
+    if (sizeof(To) < sizeof(From) && dxpl_id != H5P_DEFAULT &&
+        H5Pget_type_conv_cb(dxpl_id, &except_func, &except_data) < 0) {
+        return -1;
+    }
+
+    auto bytes = static_cast<unsigned char*>(buf);
+    if (buf_stride != 0 || except_func != nullptr) {
+        return fast_convert_elements<From, To, SwapFrom, SwapTo>(
+            src_id, dst_id, bytes, n_elements, buf_stride, except_func, except_data);
+    }
+
+    const auto& kernels = get_fast_conversion_kernels(fast_conversion_level().load());
+    if (std::is_same<From, To>::value) {
+        get_fast_swap_kernel(kernels, sizeof(From))(buf, n_elements);
+        return 0;
+    }
+
+    const auto convert = fast_convert_kernel_of<From, To>::get(kernels);
+    const size_t block_size = 512;
+    From block[block_size];
+    for (size_t k = 0; k < n_elements; k += block_size) {
+        size_t n = std::min(block_size, n_elements - k);
+        size_t offset = sizeof(To) > sizeof(From) ? n_elements - k - n : k;
+
+        std::memcpy(block, bytes + offset * sizeof(From), n * sizeof(From));
+        if (SwapFrom) {
+            get_fast_swap_kernel(kernels, sizeof(From))(block, n);
+        }
+        convert(block, bytes + offset * sizeof(To), n);
+        if (SwapTo) {
+            get_fast_swap_kernel(kernels, sizeof(To))(bytes + offset * sizeof(To), n);
+        }
+    }
+
+    return 0;
+}
+
+// A conversion function registered with HDF5, to unregister it again.
+struct FastConversionPath {
+    const char* name;
+    hid_t src_id;
+    hid_t dst_id;
+    H5T_conv_t func;
+};
+
+inline std::vector<FastConversionPath>& fast_conversion_paths() {
+    static std::vector<FastConversionPath> paths;
+    return paths;
+}
+
+template <class From, class To, bool SwapFrom = false, bool SwapTo = false>
+inline void register_fast_conversion(const char* name, hid_t src_id, hid_t dst_id) {
+    H5T_conv_t func = &fast_conversion<From, To, SwapFrom, SwapTo>;
+    detail::h5t_register(H5T_PERS_HARD, name, src_id, dst_id, func);
+    fast_conversion_paths().push_back({name, src_id, dst_id, func});
+}
+
+// Created once, HDF5 compares datatypes by their properties.
+inline hid_t fast_float16_datatype() {
+    static const hid_t hid = create_float16_datatype();
+    return hid;
+}
+
+inline hid_t fast_bfloat16_datatype() {
+    static const hid_t hid = create_bfloat16_datatype();
+    return hid;
+}
+
+// Reads `float16` and `bfloat16` datasets into `float` without HDF5's
+// conversion path: the raw data is read into the front of the buffer and
+// widened in place. Only dense memory spaces, as used by `read`, are handled.
+// See `direct_read_t`.
+inline bool fast_direct_read(hid_t dset_id,
+                             hid_t file_type_id,
+                             hid_t mem_type_id,
+                             hid_t mem_space_id,
+                             hid_t file_space_id,
+                             hid_t xfer_plist_id,
+                             void* buf) {
+    // Most reads are rejected by the size alone.
+    if (detail::h5t_get_size(file_type_id) != 2 ||
+        detail::h5t_equal(mem_type_id, H5T_NATIVE_FLOAT) <= 0) {
+        return false;
+    }
+
+    hid_t raw_type_id = H5I_INVALID_HID;
+    H5T_conv_t widen = nullptr;
+    if (detail::h5t_equal(file_type_id, fast_float16_datatype()) > 0) {
+        raw_type_id = fast_float16_datatype();
+        widen = &fast_conversion<float16_bits, float, false, false>;
+    } else if (detail::h5t_equal(file_type_id, fast_bfloat16_datatype()) > 0) {
+        raw_type_id = fast_bfloat16_datatype();
+        widen = &fast_conversion<bfloat16_t, float, false, false>;
+    } else {
+        return false;
+    }
+
+    hssize_t n_elements = -1;
+    if (mem_space_id == H5S_ALL && file_space_id == H5S_ALL) {
+        DataSpace space = detail::make_data_space(detail::h5d_get_space(dset_id));
+        n_elements = detail::h5s_get_simple_extent_npoints(space.getId());
+    } else if (mem_space_id != H5S_ALL) {
+        n_elements = detail::h5s_get_select_npoints(mem_space_id);
+        if (n_elements != detail::h5s_get_simple_extent_npoints(mem_space_id)) {
+            return false;
+        }
+    }
+    if (n_elements < 0) {
+        return false;
+    }
+
+    detail::h5d_read(dset_id, raw_type_id, mem_space_id, file_space_id, xfer_plist_id, buf);
+
+    H5T_cdata_t cdata = {};
+    cdata.command = H5T_CONV_CONV;
+    widen(raw_type_id,
+          H5T_NATIVE_FLOAT,
+          &cdata,
+          static_cast<size_t>(n_elements),
+          0,
+          0,
+          buf,
+          nullptr,
+          xfer_plist_id);
+    return true;
+}
+
+}  // namespace details
+
+inline SimdLevel get_fast_conversion_simd_level() {
+    return details::fast_conversion_level().load();
+}
+
+inline void register_fast_conversions(SimdLevel level) {
+    details::fast_conversion_level().store(std::min(level, get_supported_simd_level()));
+    if (details::fast_conversions_registered().exchange(true)) {
+        return;
+    }
+
+    using details::register_fast_conversion;
+    register_fast_conversion<int16_t, double>("highfive_i16_f64", H5T_NATIVE_INT16,
+                                              H5T_NATIVE_DOUBLE);
+    register_fast_conversion<int32_t, double>("highfive_i32_f64", H5T_NATIVE_INT32,
+                                              H5T_NATIVE_DOUBLE);
+    register_fast_conversion<float, double>("highfive_f32_f64", H5T_NATIVE_FLOAT,
+                                            H5T_NATIVE_DOUBLE);
+    register_fast_conversion<double, float>("highfive_f64_f32", H5T_NATIVE_DOUBLE,
+                                            H5T_NATIVE_FLOAT);
+
+    const hid_t float16 = details::fast_float16_datatype();
+    register_fast_conversion<details::float16_bits, float>("highfive_f16_f32",
+                                                           float16,
+                                                           H5T_NATIVE_FLOAT);
+    register_fast_conversion<float, details::float16_bits>("highfive_f32_f16",
+                                                           H5T_NATIVE_FLOAT,
+                                                           float16);
+
+    const hid_t bfloat16 = details::fast_bfloat16_datatype();
+    register_fast_conversion<bfloat16_t, float>("highfive_bf16_f32", bfloat16, H5T_NATIVE_FLOAT);
+    register_fast_conversion<float, bfloat16_t>("highfive_f32_bf16", H5T_NATIVE_FLOAT, bfloat16);
+    details::direct_read_hook().store(&details::fast_direct_read);
+
+    bool is_little_endian = detail::h5t_equal(H5T_NATIVE_INT32, H5T_STD_I32LE) > 0 &&
+                            detail::h5t_equal(H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE) > 0;
+    if (!is_little_endian) {
+        return;
+    }
+
+    register_fast_conversion<int16_t, double, true>("highfive_i16be_f64", H5T_STD_I16BE,
+                                                    H5T_NATIVE_DOUBLE);
+    register_fast_conversion<int32_t, double, true>("highfive_i32be_f64", H5T_STD_I32BE,
+                                                    H5T_NATIVE_DOUBLE);
+    register_fast_conversion<float, double, true>("highfive_f32be_f64", H5T_IEEE_F32BE,
+                                                  H5T_NATIVE_DOUBLE);
+    register_fast_conversion<double, float, true>("highfive_f64be_f32", H5T_IEEE_F64BE,
+                                                  H5T_NATIVE_FLOAT);
+    register_fast_conversion<double, float, false, true>("highfive_f64_f32be",
+                                                         H5T_NATIVE_DOUBLE,
+                                                         H5T_IEEE_F32BE);
+
+    // Byte swaps are their own inverse, the swapped integers may hold floats.
+    register_fast_conversion<int16_t, int16_t, true>("highfive_i16be_i16", H5T_STD_I16BE,
+                                                     H5T_NATIVE_INT16);
+    register_fast_conversion<int16_t, int16_t, true>("highfive_i16_i16be", H5T_NATIVE_INT16,
+                                                     H5T_STD_I16BE);
+    register_fast_conversion<int32_t, int32_t, true>("highfive_i32be_i32", H5T_STD_I32BE,
+                                                     H5T_NATIVE_INT32);
+    register_fast_conversion<int32_t, int32_t, true>("highfive_i32_i32be", H5T_NATIVE_INT32,
+                                                     H5T_STD_I32BE);
+    register_fast_conversion<int64_t, int64_t, true>("highfive_i64be_i64", H5T_STD_I64BE,
+                                                     H5T_NATIVE_INT64);
+    register_fast_conversion<int64_t, int64_t, true>("highfive_i64_i64be", H5T_NATIVE_INT64,
+                                                     H5T_STD_I64BE);
+    register_fast_conversion<int32_t, int32_t, true>("highfive_f32be_f32", H5T_IEEE_F32BE,
+                                                     H5T_NATIVE_FLOAT);
+    register_fast_conversion<int32_t, int32_t, true>("highfive_f32_f32be", H5T_NATIVE_FLOAT,
+                                                     H5T_IEEE_F32BE);
+    register_fast_conversion<int64_t, int64_t, true>("highfive_f64be_f64", H5T_IEEE_F64BE,
+                                                     H5T_NATIVE_DOUBLE);
+    register_fast_conversion<int64_t, int64_t, true>("highfive_f64_f64be", H5T_NATIVE_DOUBLE,
+                                                     H5T_IEEE_F64BE);
+}
+
+inline void unregister_fast_conversions() {
+    if (!details::fast_conversions_registered().exchange(false)) {
+        return;
+    }
+
+    details::direct_read_hook().store(nullptr);
+    // HDF5's built-in hard conversions for these pairs are gone for good, the
+    // soft conversions take over.
+    auto& paths = details::fast_conversion_paths();
+    for (const auto& path: paths) {
+        detail::h5t_unregister(H5T_PERS_HARD, path.name, path.src_id, path.dst_id, path.func);
+    }
+    paths.clear();
+}
+
+}  // namespace HighFive
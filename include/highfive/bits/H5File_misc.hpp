@@ -135,4 +135,55 @@ inline size_t File::getFreeSpace() const {
     return static_cast<size_t>(detail::h5f_get_freespace(_hid));
 }
 
+inline double File::getMetadataCacheHitRate() const {
+    double hit_rate = 0.0;
+    detail::h5f_get_mdc_hit_rate(_hid, &hit_rate);
+    return hit_rate;
+}
+
+inline void File::resetMetadataCacheHitRate() {
+    detail::h5f_reset_mdc_hit_rate_stats(_hid);
+}
+
+inline MetadataCacheSize File::getMetadataCacheSize() const {
+    MetadataCacheSize size;
+    int n_entries = 0;
+    detail::h5f_get_mdc_size(
+        _hid, &size.max_size, &size.min_clean_size, &size.current_size, &n_entries);
+    size.n_entries = static_cast<size_t>(n_entries);
+    return size;
+}
+
+inline MetadataCacheConfig File::getMetadataCacheConfig() const {
+    H5AC_cache_config_t config;
+    config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    detail::h5f_get_mdc_config(_hid, &config);
+    return MetadataCacheConfig(config);
+}
+
+inline void File::setMetadataCacheConfig(const MetadataCacheConfig& config) {
+    detail::h5f_set_mdc_config(_hid, &config.getConfig());
+}
+
+#if H5_VERSION_GE(1, 10, 1)
+inline PageBufferStatistics File::getPageBufferStatistics() const {
+    unsigned accesses[2] = {0, 0};
+    unsigned hits[2] = {0, 0};
+    unsigned misses[2] = {0, 0};
+    unsigned evictions[2] = {0, 0};
+    unsigned bypasses[2] = {0, 0};
+    detail::h5f_get_page_buffering_stats(_hid, accesses, hits, misses, evictions, bypasses);
+
+    // HDF5 stores the counters of metadata at index 0 and raw data at index 1.
+    PageBufferStatistics stats;
+    stats.metadata = {accesses[0], hits[0], misses[0], evictions[0], bypasses[0]};
+    stats.raw_data = {accesses[1], hits[1], misses[1], evictions[1], bypasses[1]};
+    return stats;
+}
+
+inline void File::resetPageBufferStatistics() {
+    detail::h5f_reset_page_buffering_stats(_hid);
+}
+#endif
+
 }  // namespace HighFive
@@ -0,0 +1,475 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <H5Apublic.h>
+#include <H5Dpublic.h>
+#include <H5Ipublic.h>
+#include <H5Spublic.h>
+#include <H5Tpublic.h>
+
+namespace HighFive {
+
+///
+/// \brief A call into the HDF5 library made by HighFive.
+///
+/// Besides HDF5 calls, the conversion of data between the user's containers
+/// and HDF5 buffers is recorded as `serialize` and `unserialize`.
+///
+/// Records are only created if HighFive is compiled with
+/// `HIGHFIVE_ENABLE_INSTRUMENTATION` defined.
+///
+/// \since 3.0
+struct InstrumentationRecord {
+    /// The HighFive wrapper of the HDF5 function, e.g. `h5d_read` for `H5Dread`.
+    const char* function;
+
+    /// The object the call operates on, or `H5I_INVALID_HID`. For calls which
+    /// create a dataset or attribute, the object created.
+    hid_t object;
+
+    /// The size in bytes of the memory buffer of a read or write, otherwise 0.
+    size_t bytes;
+
+    /// The duration of the call, including HighFive's error handling.
+    std::chrono::nanoseconds duration;
+
+    /// The time at which the call started.
+    std::chrono::steady_clock::time_point start;
+
+    /// The number of elements read, written or converted, otherwise 0.
+    size_t elements;
+};
+
+///
+/// \brief Delivers `InstrumentationRecord`s to a callback.
+///
+/// This is intended to be used as a singleton, via
+/// `get_global_instrumentation()`. The callback is called on the thread that
+/// made the HDF5 call and must not throw. Calls into HDF5 made by the callback
+/// itself aren't recorded.
+///
+/// Records are delivered by a destructor. Hence, calls which fail are recorded
+/// too, while the exception reporting the failure is propagating; an exception
+/// thrown by the callback terminates the program.
+///
+/// The callback can be replaced while other threads are recording. A call
+/// which already started delivering a record to the previous callback
+/// completes, i.e. the previous callback may still run briefly after it was
+/// replaced.
+///
+/// \since 3.0
+class Instrumentation {
+  public:
+    using callback_type = std::function<void(const InstrumentationRecord&)>;
+
+    Instrumentation() = default;
+    Instrumentation(const Instrumentation&) = delete;
+    Instrumentation& operator=(const Instrumentation&) = delete;
+
+    inline bool enabled() const noexcept {
+        return _enabled.load(std::memory_order_acquire);
+    }
+
+    inline void record(const InstrumentationRecord& record) {
+        std::shared_ptr<const callback_type> cb;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            cb = _cb;
+        }
+
+        if (cb) {
+            (*cb)(record);
+        }
+    }
+
+    inline void set_instrumentation_callback(callback_type cb) {
+        std::shared_ptr<const callback_type> new_cb;
+        if (cb) {
+            new_cb = std::make_shared<const callback_type>(std::move(cb));
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _enabled.store(static_cast<bool>(new_cb), std::memory_order_release);
+        _cb.swap(new_cb);
+    }
+
+  private:
+    std::mutex _mutex;
+    std::atomic<bool> _enabled{false};
+    std::shared_ptr<const callback_type> _cb;
+};
+
+/// \brief Obtain a reference to the instrumentation used by HighFive.
+inline Instrumentation& get_global_instrumentation() {
+    static Instrumentation instrumentation;
+    return instrumentation;
+}
+
+/// \brief Sets the callback that receives the records, an empty callback
+/// stops recording.
+inline void register_instrumentation_callback(Instrumentation::callback_type cb) {
+    get_global_instrumentation().set_instrumentation_callback(std::move(cb));
+}
+
+namespace detail {
+// The path of `id`, or an empty string. Uses the C API directly, the wrappers
+// would record these calls.
+inline std::string get_instrumented_path(hid_t id) {
+    ssize_t length = H5Iget_name(id, nullptr, 0);
+    if (length <= 0) {
+        return {};
+    }
+
+    std::vector<char> buffer(static_cast<size_t>(length) + 1);
+    H5Iget_name(id, buffer.data(), buffer.size());
+    return std::string(buffer.data(), static_cast<size_t>(length));
+}
+}  // namespace detail
+
+///
+/// \brief Aggregates `InstrumentationRecord`s per function and per dataset.
+///
+/// \code{.cpp}
+/// CallStatistics stats;
+/// register_instrumentation_callback(
+///     [&stats](const InstrumentationRecord& record) { stats.record(record); });
+/// \endcode
+///
+/// Thread-safe.
+///
+/// \since 3.0
+class CallStatistics {
+  public:
+    struct Entry {
+        size_t calls = 0;
+        size_t bytes = 0;
+        std::chrono::nanoseconds duration{0};
+    };
+
+    ///
+    /// \brief Add a record, calls on a dataset are also counted for its path.
+    ///
+    inline void record(const InstrumentationRecord& record) {
+        std::string path;
+        if (record.object > 0 && H5Iget_type(record.object) == H5I_DATASET) {
+            path = detail::get_instrumented_path(record.object);
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        add(_by_function[record.function], record);
+        if (!path.empty()) {
+            add(_by_path[path], record);
+        }
+    }
+
+    /// \brief The statistics by name of the wrapper, e.g. `h5d_read`.
+    inline std::map<std::string, Entry> byFunction() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _by_function;
+    }
+
+    /// \brief The statistics of the calls on a dataset, by its path.
+    inline std::map<std::string, Entry> byPath() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _by_path;
+    }
+
+    inline void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _by_function.clear();
+        _by_path.clear();
+    }
+
+  private:
+    static void add(Entry& entry, const InstrumentationRecord& record) {
+        entry.calls += 1;
+        entry.bytes += record.bytes;
+        entry.duration += record.duration;
+    }
+
+    mutable std::mutex _mutex;
+    std::map<std::string, Entry> _by_function;
+    std::map<std::string, Entry> _by_path;
+};
+
+///
+/// \brief Counters of the copies made between containers and HDF5 buffers.
+///
+/// Containers which aren't contiguous in memory, e.g.
+/// `std::vector<std::vector<double>>`, are deep copied into, or out of, a
+/// scratch buffer. Strings are always copied. These copies come on top of the
+/// I/O and can be avoided by choosing a different container.
+///
+/// The counters are only updated if HighFive is compiled with
+/// `HIGHFIVE_ENABLE_INSTRUMENTATION` defined.
+///
+/// \sa get_converter_statistics, get_thread_converter_statistics
+///
+/// \since 3.0
+struct ConverterStatistics {
+    /// Number of containers passed to HDF5 without copying them.
+    size_t shallow_copies = 0;
+    /// Number of containers copied into, or out of, a scratch buffer.
+    size_t deep_copies = 0;
+    /// Number of containers of strings copied into, or out of, a scratch buffer.
+    size_t string_copies = 0;
+    /// Bytes allocated for scratch buffers.
+    size_t scratch_bytes = 0;
+    /// Time spent copying containers into scratch buffers.
+    std::chrono::nanoseconds serialize_duration{0};
+    /// Time spent copying scratch buffers into containers.
+    std::chrono::nanoseconds unserialize_duration{0};
+    /// Time spent freeing the memory HDF5 allocated for variable length data.
+    std::chrono::nanoseconds reclaim_duration{0};
+};
+
+namespace detail {
+enum class ConverterCounter {
+    ShallowCopies,
+    DeepCopies,
+    StringCopies,
+    ScratchBytes,
+    SerializeNs,
+    UnserializeNs,
+    ReclaimNs,
+    Count
+};
+
+constexpr size_t n_converter_counters = static_cast<size_t>(ConverterCounter::Count);
+
+inline std::atomic<uint64_t>* global_converter_counters() noexcept {
+    static std::atomic<uint64_t> counters[n_converter_counters] = {};
+    return counters;
+}
+
+inline uint64_t* thread_converter_counters() noexcept {
+    static thread_local uint64_t counters[n_converter_counters] = {};
+    return counters;
+}
+
+inline void add_converter_count(ConverterCounter counter, uint64_t value) noexcept {
+    auto i = static_cast<size_t>(counter);
+    global_converter_counters()[i].fetch_add(value, std::memory_order_relaxed);
+    thread_converter_counters()[i] += value;
+}
+
+// Count a container passed to HDF5, `bytes` is the size of the scratch buffer.
+inline void count_conversion(ConverterCounter copy, size_t bytes) noexcept {
+    add_converter_count(copy, 1);
+    add_converter_count(ConverterCounter::ScratchBytes, bytes);
+}
+
+inline ConverterStatistics make_converter_statistics(const uint64_t* counters) {
+    auto get = [counters](ConverterCounter counter) {
+        return counters[static_cast<size_t>(counter)];
+    };
+
+    ConverterStatistics stats;
+    stats.shallow_copies = static_cast<size_t>(get(ConverterCounter::ShallowCopies));
+    stats.deep_copies = static_cast<size_t>(get(ConverterCounter::DeepCopies));
+    stats.string_copies = static_cast<size_t>(get(ConverterCounter::StringCopies));
+    stats.scratch_bytes = static_cast<size_t>(get(ConverterCounter::ScratchBytes));
+    stats.serialize_duration = std::chrono::nanoseconds(get(ConverterCounter::SerializeNs));
+    stats.unserialize_duration = std::chrono::nanoseconds(get(ConverterCounter::UnserializeNs));
+    stats.reclaim_duration = std::chrono::nanoseconds(get(ConverterCounter::ReclaimNs));
+    return stats;
+}
+
+// Adds the time spent in its scope to `counter`.
+class ConverterTimer {
+  public:
+    explicit ConverterTimer(ConverterCounter counter)
+        : _counter(counter)
+        , _start(std::chrono::steady_clock::now()) {}
+
+    ConverterTimer(const ConverterTimer&) = delete;
+    ConverterTimer& operator=(const ConverterTimer&) = delete;
+
+    ~ConverterTimer() {
+        auto duration = std::chrono::steady_clock::now() - _start;
+        add_converter_count(
+            _counter,
+            static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+    }
+
+  private:
+    ConverterCounter _counter;
+    std::chrono::steady_clock::time_point _start;
+};
+}  // namespace detail
+
+/// \brief The copies made by all threads since the last reset.
+inline ConverterStatistics get_converter_statistics() {
+    uint64_t counters[detail::n_converter_counters];
+    for (size_t i = 0; i < detail::n_converter_counters; ++i) {
+        counters[i] = detail::global_converter_counters()[i].load(std::memory_order_relaxed);
+    }
+    return detail::make_converter_statistics(counters);
+}
+
+/// \brief The copies made by the calling thread since its last reset.
+inline ConverterStatistics get_thread_converter_statistics() {
+    return detail::make_converter_statistics(detail::thread_converter_counters());
+}
+
+/// \brief Reset the counters of all threads combined.
+inline void reset_converter_statistics() noexcept {
+    for (size_t i = 0; i < detail::n_converter_counters; ++i) {
+        detail::global_converter_counters()[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+/// \brief Reset the counters of the calling thread.
+inline void reset_thread_converter_statistics() noexcept {
+    for (size_t i = 0; i < detail::n_converter_counters; ++i) {
+        detail::thread_converter_counters()[i] = 0;
+    }
+}
+
+namespace detail {
+
+// Records the HDF5 call made in the scope of this object. Nothing is measured
+// unless a callback is registered.
+class InstrumentedCall {
+  public:
+    InstrumentedCall(const char* function, hid_t object)
+        : InstrumentedCall(function, object, H5I_INVALID_HID, H5S_ALL, H5S_ALL) {}
+
+    InstrumentedCall(const char* function,
+                     hid_t object,
+                     hid_t mem_type,
+                     hid_t mem_space,
+                     hid_t file_space)
+        : _function(function)
+        , _object(object)
+        , _active(get_global_instrumentation().enabled() && !in_callback()) {
+        if (_active) {
+            if (mem_type != H5I_INVALID_HID) {
+                _elements = transfer_elements(object, mem_space, file_space);
+                _bytes = _elements * H5Tget_size(mem_type);
+            }
+            _start = std::chrono::steady_clock::now();
+        }
+    }
+
+    // Work other than a call into HDF5, e.g. converting data.
+    InstrumentedCall(const char* function, size_t elements, size_t bytes)
+        : _function(function)
+        , _object(H5I_INVALID_HID)
+        , _active(get_global_instrumentation().enabled() && !in_callback())
+        , _elements(elements)
+        , _bytes(bytes) {
+        if (_active) {
+            _start = std::chrono::steady_clock::now();
+        }
+    }
+
+    InstrumentedCall(const InstrumentedCall&) = delete;
+    InstrumentedCall& operator=(const InstrumentedCall&) = delete;
+
+    // Attribute the call to the object it created.
+    void setObject(hid_t object) noexcept {
+        _object = object;
+    }
+
+    ~InstrumentedCall() {
+        if (_active) {
+            auto duration = std::chrono::steady_clock::now() - _start;
+            InstrumentationRecord record{
+                _function,
+                _object,
+                _bytes,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration),
+                _start,
+                _elements};
+
+            in_callback() = true;
+            get_global_instrumentation().record(record);
+            in_callback() = false;
+        }
+    }
+
+  private:
+    static bool& in_callback() noexcept {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    // The number of elements transferred, uses the C API directly to avoid
+    // recording these calls.
+    static size_t transfer_elements(hid_t object, hid_t mem_space, hid_t file_space) {
+        hssize_t n_elements = -1;
+        if (mem_space != H5S_ALL) {
+            n_elements = H5Sget_select_npoints(mem_space);
+        } else if (file_space != H5S_ALL) {
+            n_elements = H5Sget_select_npoints(file_space);
+        } else {
+            hid_t space = H5Iget_type(object) == H5I_ATTR ? H5Aget_space(object)
+                                                           : H5Dget_space(object);
+            if (space >= 0) {
+                n_elements = H5Sget_select_npoints(space);
+                H5Sclose(space);
+            }
+        }
+
+        return n_elements > 0 ? static_cast<size_t>(n_elements) : 0;
+    }
+
+    const char* _function;
+    hid_t _object;
+    bool _active;
+    size_t _elements = 0;
+    size_t _bytes = 0;
+    std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace detail
+}  // namespace HighFive
+
+#ifdef HIGHFIVE_ENABLE_INSTRUMENTATION
+#define HIGHFIVE_INSTRUMENT(object) \
+    ::HighFive::detail::InstrumentedCall highfive_instrumented_call(__func__, (object))
+
+#define HIGHFIVE_INSTRUMENT_TRANSFER(object, mem_type, mem_space, file_space) \
+    ::HighFive::detail::InstrumentedCall highfive_instrumented_call(          \
+        __func__, (object), (mem_type), (mem_space), (file_space))
+
+#define HIGHFIVE_INSTRUMENT_RESULT(object) highfive_instrumented_call.setObject(object)
+
+#define HIGHFIVE_INSTRUMENT_SPAN(name, elements, bytes) \
+    ::HighFive::detail::InstrumentedCall highfive_instrumented_call((name), (elements), (bytes))
+
+#define HIGHFIVE_COUNT_CONVERSION(copy, bytes) \
+    ::HighFive::detail::count_conversion(::HighFive::detail::ConverterCounter::copy, (bytes))
+
+#define HIGHFIVE_TIME_CONVERSION(counter)                        \
+    ::HighFive::detail::ConverterTimer highfive_converter_timer( \
+        ::HighFive::detail::ConverterCounter::counter)
+#else
+#define HIGHFIVE_INSTRUMENT(object)
+#define HIGHFIVE_INSTRUMENT_TRANSFER(object, mem_type, mem_space, file_space)
+#define HIGHFIVE_INSTRUMENT_RESULT(object)
+#define HIGHFIVE_INSTRUMENT_SPAN(name, elements, bytes)
+#define HIGHFIVE_COUNT_CONVERSION(copy, bytes)
+#define HIGHFIVE_TIME_CONVERSION(counter)
+#endif
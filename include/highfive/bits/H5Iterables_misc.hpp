@@ -50,5 +50,25 @@ inline herr_t internal_high_five_iterate(hid_t /*id*/,
     return -1;
 }
 
+// The batches of names fetched by `ObjectNameIterator`.
+constexpr size_t object_name_min_batch = 256;
+constexpr size_t object_name_max_batch = 65536;
+
+struct HighFiveNameBatch {
+    std::vector<std::string>& names;
+    size_t size;
+};
+
+// Stores the names of the links it's called with, until the batch is full.
+template <typename InfoType>
+inline herr_t internal_high_five_name_batch(hid_t /*id*/,
+                                            const char* name,
+                                            const InfoType* /*info*/,
+                                            void* op_data) {
+    auto* batch = static_cast<HighFiveNameBatch*>(op_data);
+    batch->names.emplace_back(name);
+    return batch->names.size() < batch->size ? 0 : 1;
+}
+
 }  // namespace details
 }  // namespace HighFive
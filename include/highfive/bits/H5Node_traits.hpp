@@ -8,11 +8,19 @@
  */
 #pragma once
 
+#include <iterator>
+#include <map>
+#include <memory>
 #include <string>
+#include <typeindex>
+#include <unordered_set>
+#include <vector>
 
+#include "../H5DataType.hpp"
 #include "../H5PropertyList.hpp"
 #include "H5_definitions.hpp"
 #include "H5Converter_misc.hpp"
+#include "H5Optional.hpp"
 
 namespace HighFive {
 
@@ -21,6 +29,38 @@ enum class IndexType : std::underlying_type<H5_index_t>::type {
     CRT_ORDER = H5_INDEX_CRT_ORDER,
 };
 
+///
+/// \brief Optional information gathered by `NodeTraits::visit`.
+///
+/// The path, link type, object type and address are always retrieved. The
+/// remaining fields require additional metadata lookups per object and are
+/// only retrieved on request. Fields can be combined with `|`.
+enum class VisitFields : unsigned {
+    Basic = 0x00u,
+    Dimensions = 0x01u,
+    DataType = 0x02u,
+    AttributeNames = 0x04u,
+};
+
+inline VisitFields operator|(VisitFields lhs, VisitFields rhs) {
+    using int_t = std::underlying_type<VisitFields>::type;
+    return static_cast<VisitFields>(static_cast<int_t>(lhs) | static_cast<int_t>(rhs));
+}
+
+inline VisitFields operator&(VisitFields lhs, VisitFields rhs) {
+    using int_t = std::underlying_type<VisitFields>::type;
+    return static_cast<VisitFields>(static_cast<int_t>(lhs) & static_cast<int_t>(rhs));
+}
+
+struct NodeInfo;
+class ObjectNameRange;
+template <typename Derivate>
+class CreationContext;
+
+namespace details {
+class PathCache;
+}
+
 ///
 /// \brief NodeTraits: Base class for Group and File
 ///
@@ -86,6 +126,41 @@ class NodeTraits {
     DataSet getDataSet(const std::string& dataset_name,
                        const DataSetAccessProps& accessProps = DataSetAccessProps::Default()) const;
 
+    ///
+    /// \brief Open the dataset `dataset_name`, if it exists.
+    ///
+    /// Unlike `exist` followed by `getDataSet`, no exception is created for a
+    /// missing dataset. The links along the path are checked before opening
+    /// the dataset, such that a missing path doesn't cause a failing call to
+    /// HDF5. Objects which aren't datasets, and dangling links, are treated
+    /// as missing.
+    ///
+    /// \since 3.0
+    Optional<DataSet> tryGetDataSet(
+        const std::string& dataset_name,
+        const DataSetAccessProps& accessProps = DataSetAccessProps::Default()) const;
+
+    ///
+    /// \brief Read the dataset `dataset_name` into `array`, if it exists.
+    ///
+    /// Lookup as in `tryGetDataSet`. Errors while reading an existing dataset
+    /// are reported by exceptions, as for `DataSet::read`.
+    ///
+    /// \return false, if the dataset doesn't exist.
+    /// \since 3.0
+    template <typename T>
+    bool tryRead(const std::string& dataset_name,
+                 T& array,
+                 const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// \brief Read the dataset `dataset_name`, if it exists.
+    ///
+    /// \since 3.0
+    template <typename T>
+    Optional<T> tryRead(const std::string& dataset_name,
+                        const DataTransferProps& xfer_props = DataTransferProps()) const;
+
     ///
     /// \brief create a new group, and eventually intermediate groups
     /// \param group_name
@@ -103,6 +178,38 @@ class NodeTraits {
                       const GroupCreateProps& createProps,
                       bool parents = true);
 
+    ///
+    /// \brief Create many groups, creating every intermediate group once.
+    ///
+    /// The paths are sorted, such that groups with common ancestors are
+    /// created one after the other. Each group is created relative to its
+    /// already open parent, instead of resolving every path from this node.
+    /// Missing intermediate groups are created with default properties.
+    /// Duplicate paths are created once.
+    ///
+    /// \param group_names The groups to create, none may exist already.
+    /// \param createProps The group creation properties of the requested groups.
+    /// \since 3.0
+    void createGroups(std::vector<std::string> group_names,
+                      const GroupCreateProps& createProps = GroupCreateProps::Default());
+
+    ///
+    /// \brief Prepare the creation of many datasets or groups in this node.
+    ///
+    /// The property lists are created once and shared by all objects created
+    /// with the returned context, see \ref CreationContext.
+    ///
+    /// \param createProps The dataset creation properties.
+    /// \param accessProps The dataset access properties.
+    /// \param groupCreateProps The group creation properties.
+    /// \param parents Create intermediate groups if needed. Default: true.
+    /// \since 3.0
+    CreationContext<Derivate> prepareCreation(
+        const DataSetCreateProps& createProps = DataSetCreateProps::Default(),
+        const DataSetAccessProps& accessProps = DataSetAccessProps::Default(),
+        const GroupCreateProps& groupCreateProps = GroupCreateProps::Default(),
+        bool parents = true) const;
+
     ///
     /// \brief open an existing group with the name group_name
     /// \param group_name
@@ -145,6 +252,37 @@ class NodeTraits {
     /// \return number of leaf objects
     std::vector<std::string> listObjectNames(IndexType idx_type = IndexType::NAME) const;
 
+    ///
+    /// \brief Lazily iterate over the names of the objects in this node / group.
+    ///
+    /// Unlike `listObjectNames`, the names are retrieved one at a time while
+    /// iterating, no vector of all names is built. The group must not be
+    /// modified while iterating.
+    ///
+    /// \code{.cpp}
+    /// for (const auto& name: group.iterateObjectNames()) { ... }
+    /// \endcode
+    ///
+    /// \param idx_type tell if the names should be ordered by Name or CreationOrderTime.
+    ObjectNameRange iterateObjectNames(IndexType idx_type = IndexType::NAME) const;
+
+    ///
+    /// \brief Recursively visit all links below this node / group.
+    ///
+    /// Calls `callback(const NodeInfo&)` once per link, in a single traversal
+    /// that resolves every link relative to its parent group. Compared to
+    /// combining `listObjectNames`, `getLinkType` and `getObjectType`
+    /// recursively this avoids re-resolving paths from the top.
+    ///
+    /// Soft and external links are reported but not followed. Groups reachable
+    /// through several hard links are reported for each link, but their
+    /// content is visited only once.
+    ///
+    /// \param callback called with a `const NodeInfo&` for every link.
+    /// \param fields additional, more expensive, information to retrieve.
+    template <class F>
+    void visit(F&& callback, VisitFields fields = VisitFields::Basic) const;
+
     ///
     /// \brief check a dataset or group exists in the current node / group
     /// \param node_name dataset/group name to check
@@ -156,6 +294,42 @@ class NodeTraits {
     /// \param node_name dataset/group name to unlink
     void unlink(const std::string& node_name) const;
 
+    ///
+    /// \brief Keep the handles of objects looked up by path open for reuse.
+    ///
+    /// With the cache enabled, `getDataSet`, `getGroup` and `exist` start
+    /// from the cached handle of the object, or of its closest parent group,
+    /// and resolve only the remaining path components. Intermediate groups
+    /// are added to the cache along the way, hence every component is
+    /// resolved only once. Existence probes don't need to silence the HDF5
+    /// error stack, unless they traverse soft or external links.
+    ///
+    /// Objects created through this node are added to the cache, `unlink`
+    /// and `rename` clear it. Modifications made through other objects, e.g.
+    /// a different `Group` of the same file, aren't detected. Copies of this
+    /// object made after enabling the cache share it.
+    ///
+    /// The cache is guarded by a mutex, i.e. const lookups may be issued from
+    /// several threads, as far as the HDF5 library permits it. Enabling or
+    /// disabling the cache concurrently with lookups isn't safe.
+    ///
+    /// \param capacity The maximum number of handles kept open, the least
+    ///                 recently used handles are closed first.
+    /// \since 3.0
+    void enablePathCache(size_t capacity = 128);
+
+    ///
+    /// \brief Close all cached handles and stop caching.
+    ///
+    /// \since 3.0
+    void disablePathCache();
+
+    ///
+    /// \brief Close all cached handles, the cache stays enabled.
+    ///
+    /// \since 3.0
+    void clearPathCache() const;
+
     ///
     /// \brief Returns the kind of link of the given name (soft, hard...)
     /// \param node_name The entry to check, path relative to the current group
@@ -217,6 +391,32 @@ class NodeTraits {
     // It makes behavior consistent among versions and by default transforms
     // errors to exceptions
     bool _exist(const std::string& node_name, bool raise_errors = true) const;
+
+    enum class PathStatus { Found, Missing, Unresolved };
+
+    // Opens the parent group of the cache key `key`, through the path cache.
+    // Returns `Unresolved` if that isn't possible without errors, e.g. due to
+    // soft or external links.
+    PathStatus _resolve_parent(const std::string& key, Group& parent, std::string& leaf) const;
+
+    void _cache_object(const std::string& path, hid_t hid) const;
+
+    template <class F>
+    static void _visit_group(hid_t group_id,
+                             const std::string& prefix,
+                             F& callback,
+                             VisitFields fields,
+                             std::unordered_set<haddr_t>& visited);
+
+    template <class F, class InfoType>
+    static herr_t _visit_link(hid_t group_id,
+                              const char* name,
+                              const InfoType* info,
+                              void* op_data);
+
+    std::shared_ptr<details::PathCache> _path_cache;
+
+    friend class CreationContext<Derivate>;
 };
 
 
@@ -230,5 +430,176 @@ enum class LinkType {
     Other  // Reserved or User-defined
 };
 
+///
+/// \brief Information about a link found by `NodeTraits::visit`.
+///
+struct NodeInfo {
+    /// Path of the link, relative to the visited node / group.
+    std::string path;
+
+    /// The kind of link.
+    LinkType link_type = LinkType::Hard;
+
+    /// The type of the object. Soft and external links aren't followed and
+    /// are reported as `ObjectType::Other`.
+    ObjectType object_type = ObjectType::Other;
+
+    /// Address of the object in the file, `HADDR_UNDEF` for soft and external
+    /// links.
+    haddr_t address = HADDR_UNDEF;
+
+    /// Dimensions of a dataset, requires `VisitFields::Dimensions`.
+    std::vector<size_t> dimensions;
+
+    /// Datatype of a dataset, requires `VisitFields::DataType`.
+    DataType data_type;
+
+    /// Names of the attributes of the object, requires
+    /// `VisitFields::AttributeNames`.
+    std::vector<std::string> attribute_names;
+};
+
+///
+/// \brief Input iterator over the names of the objects in a group.
+///
+/// The names are fetched in batches, which grow geometrically, such that
+/// iterating over all names requires a logarithmic number of passes over the
+/// links of the group.
+///
+/// \sa NodeTraits::iterateObjectNames
+class ObjectNameIterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::string;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::string*;
+    using reference = const std::string&;
+
+    reference operator*() const noexcept {
+        return _names[_position];
+    }
+
+    pointer operator->() const noexcept {
+        return &_names[_position];
+    }
+
+    ObjectNameIterator& operator++();
+
+    bool operator==(const ObjectNameIterator& other) const noexcept {
+        if (_is_end || other._is_end) {
+            return _is_end == other._is_end;
+        }
+        return _index == other._index;
+    }
+
+    bool operator!=(const ObjectNameIterator& other) const noexcept {
+        return !(*this == other);
+    }
+
+  private:
+    ObjectNameIterator(hid_t group_id, H5_index_t idx_type, bool is_end);
+    void fetch();
+
+    hid_t _group_id;
+    H5_index_t _idx_type;
+    hsize_t _index = 0;
+    hsize_t _next = 0;
+    size_t _batch_size;
+    size_t _position = 0;
+    bool _is_complete = false;
+    bool _is_end;
+    std::vector<std::string> _names;
+
+    friend class ObjectNameRange;
+};
+
+///
+/// \brief A range over the names of the objects in a group.
+///
+/// Keeps the group open while the range exists.
+///
+/// \sa NodeTraits::iterateObjectNames
+class ObjectNameRange {
+  public:
+    ObjectNameRange(const ObjectNameRange& other);
+    ObjectNameRange(ObjectNameRange&& other) noexcept;
+    ObjectNameRange& operator=(const ObjectNameRange& other) = delete;
+    ~ObjectNameRange();
+
+    ObjectNameIterator begin() const;
+    ObjectNameIterator end() const;
+
+  private:
+    ObjectNameRange(hid_t group_id, IndexType idx_type);
+
+    hid_t _group_id;
+    IndexType _idx_type;
+
+    template <typename Derivate>
+    friend class NodeTraits;
+};
+
+///
+/// \brief Creates many datasets or groups in the same node / group.
+///
+/// The link creation, dataset creation and access, and group creation
+/// property lists are prepared once and reused for every object. The
+/// datatypes and dataspaces deduced from the data are cached as well.
+///
+/// \code{.cpp}
+/// auto context = file.prepareCreation(dcpl);
+/// for (size_t i = 0; i < values.size(); ++i) {
+///     context.createDataSet("data/" + std::to_string(i), values[i]);
+/// }
+/// \endcode
+///
+/// \sa NodeTraits::prepareCreation
+/// \since 3.0
+template <typename Derivate>
+class CreationContext {
+  public:
+    ///
+    /// \brief Create a new dataset with the prepared properties.
+    DataSet createDataSet(const std::string& dataset_name,
+                          const DataSpace& space,
+                          const DataType& type);
+
+    ///
+    /// \brief Create a new dataset of type `T` with the prepared properties.
+    template <typename T>
+    DataSet createDataSet(const std::string& dataset_name, const DataSpace& space);
+
+    ///
+    /// \brief Create a new dataset with the prepared properties and write
+    /// `data` to it.
+    template <typename T>
+    DataSet createDataSet(const std::string& dataset_name, const T& data);
+
+    ///
+    /// \brief Create a new group with the prepared properties.
+    Group createGroup(const std::string& group_name);
+
+  private:
+    CreationContext(const Derivate& node,
+                    const DataSetCreateProps& createProps,
+                    const DataSetAccessProps& accessProps,
+                    const GroupCreateProps& groupCreateProps,
+                    bool parents);
+
+    template <typename T>
+    const DataType& _get_datatype();
+    const DataSpace& _get_space(const std::vector<size_t>& dims);
+
+    Derivate _node;
+    LinkCreateProps _lcpl;
+    DataSetCreateProps _dcpl;
+    DataSetAccessProps _dapl;
+    GroupCreateProps _gcpl;
+    std::map<std::type_index, DataType> _datatypes;
+    std::map<std::vector<size_t>, DataSpace> _spaces;
+
+    friend class NodeTraits<Derivate>;
+};
+
 
 }  // namespace HighFive
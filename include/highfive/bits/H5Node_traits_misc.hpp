@@ -8,7 +8,12 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <exception>
 #include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_set>
 #include <vector>
 
 #include <H5Apublic.h>
@@ -25,13 +30,33 @@
 #include "H5Selection_misc.hpp"
 #include "H5Slice_traits_misc.hpp"
 
+#include "h5a_wrapper.hpp"
+#include "h5i_wrapper.hpp"
 #include "h5l_wrapper.hpp"
 #include "h5g_wrapper.hpp"
 #include "h5o_wrapper.hpp"
+#include "H5PathCache.hpp"
 
 
 namespace HighFive {
 
+namespace details {
+
+// Checks the links along `path` one by one, since `H5Lexists` fails if an
+// intermediate group is missing.
+inline bool link_path_exists(hid_t loc_id, const std::string& path) {
+    for (size_t end = path.find('/', 1);; end = path.find('/', end + 1)) {
+        auto prefix = path.substr(0, end);
+        if (detail::nothrow::h5l_exists(loc_id, prefix.c_str(), H5P_DEFAULT) <= 0) {
+            return false;
+        }
+        if (end == std::string::npos) {
+            return true;
+        }
+    }
+}
+
+}  // namespace details
 
 template <typename Derivate>
 inline DataSet NodeTraits<Derivate>::createDataSet(const std::string& dataset_name,
@@ -42,13 +67,15 @@ inline DataSet NodeTraits<Derivate>::createDataSet(const std::string& dataset_na
                                                    bool parents) {
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
-    return DataSet(detail::h5d_create2(static_cast<Derivate*>(this)->getId(),
-                                       dataset_name.c_str(),
-                                       dtype.getId(),
-                                       space.getId(),
-                                       lcpl.getId(),
-                                       createProps.getId(),
-                                       accessProps.getId()));
+    DataSet dataset(detail::h5d_create2(static_cast<Derivate*>(this)->getId(),
+                                        dataset_name.c_str(),
+                                        dtype.getId(),
+                                        space.getId(),
+                                        lcpl.getId(),
+                                        createProps.getId(),
+                                        accessProps.getId()));
+    _cache_object(dataset_name, dataset.getId());
+    return dataset;
 }
 
 template <typename Derivate>
@@ -83,20 +110,128 @@ inline DataSet NodeTraits<Derivate>::createDataSet(const std::string& dataset_na
 template <typename Derivate>
 inline DataSet NodeTraits<Derivate>::getDataSet(const std::string& dataset_name,
                                                 const DataSetAccessProps& accessProps) const {
+    // Cached handles were opened with the default access properties.
+    if (_path_cache && accessProps.getId() == H5P_DEFAULT) {
+        auto key = details::PathCache::key(dataset_name);
+        hid_t hid = _path_cache->acquire(key);
+        if (hid != H5I_INVALID_HID) {
+            if (detail::h5i_get_type(hid) == H5I_DATASET) {
+                return DataSet(hid);
+            }
+            detail::nothrow::h5i_dec_ref(hid);
+        }
+
+        Group parent;
+        std::string leaf;
+        if (hid == H5I_INVALID_HID && _resolve_parent(key, parent, leaf) == PathStatus::Found &&
+            detail::nothrow::h5l_exists(parent.getId(), leaf.c_str(), H5P_DEFAULT) > 0) {
+            DataSet dataset(detail::h5d_open2(parent.getId(), leaf.c_str(), H5P_DEFAULT));
+            _path_cache->insert(key, dataset.getId());
+            return dataset;
+        }
+    }
+
     return DataSet(detail::h5d_open2(static_cast<const Derivate*>(this)->getId(),
                                      dataset_name.c_str(),
                                      accessProps.getId()));
 }
 
+template <typename Derivate>
+inline Optional<DataSet> NodeTraits<Derivate>::tryGetDataSet(
+    const std::string& dataset_name,
+    const DataSetAccessProps& accessProps) const {
+    hid_t loc_id = static_cast<const Derivate*>(this)->getId();
+    const char* name = dataset_name.c_str();
+
+    // Cached handles were opened with the default access properties.
+    const bool use_cache = _path_cache && accessProps.getId() == H5P_DEFAULT;
+    bool is_checked = false;
+    std::string key;
+    Group parent;
+    std::string leaf;
+    if (use_cache) {
+        key = details::PathCache::key(dataset_name);
+        hid_t hid = _path_cache->acquire(key);
+        if (hid != H5I_INVALID_HID) {
+            if (detail::h5i_get_type(hid) != H5I_DATASET) {
+                detail::nothrow::h5i_dec_ref(hid);
+                return {};
+            }
+            return DataSet(hid);
+        }
+
+        if (!key.empty() && key != "/") {
+            auto status = _resolve_parent(key, parent, leaf);
+            if (status == PathStatus::Missing) {
+                return {};
+            }
+            if (status == PathStatus::Found) {
+                if (detail::nothrow::h5l_exists(parent.getId(), leaf.c_str(), H5P_DEFAULT) == 0) {
+                    return {};
+                }
+                loc_id = parent.getId();
+                name = leaf.c_str();
+                is_checked = true;
+            }
+        }
+    }
+
+    // Checking the links of a missing group fails. Only the failure matters,
+    // not the reason.
+    SilenceHDF5 silencer{};
+    if (!is_checked && !details::link_path_exists(loc_id, dataset_name)) {
+        return {};
+    }
+
+    // Opening still fails for dangling links and objects which aren't datasets.
+    hid_t hid = detail::nothrow::h5d_open2(loc_id, name, accessProps.getId());
+    if (hid == H5I_INVALID_HID) {
+        return {};
+    }
+
+    DataSet dataset(hid);
+    if (use_cache) {
+        _path_cache->insert(key, hid);
+    }
+    return dataset;
+}
+
+template <typename Derivate>
+template <typename T>
+inline bool NodeTraits<Derivate>::tryRead(const std::string& dataset_name,
+                                          T& array,
+                                          const DataTransferProps& xfer_props) const {
+    auto dataset = tryGetDataSet(dataset_name);
+    if (!dataset) {
+        return false;
+    }
+
+    dataset->read(array, xfer_props);
+    return true;
+}
+
+template <typename Derivate>
+template <typename T>
+inline Optional<T> NodeTraits<Derivate>::tryRead(const std::string& dataset_name,
+                                                 const DataTransferProps& xfer_props) const {
+    T array;
+    if (!tryRead(dataset_name, array, xfer_props)) {
+        return {};
+    }
+    return Optional<T>(std::move(array));
+}
+
 template <typename Derivate>
 inline Group NodeTraits<Derivate>::createGroup(const std::string& group_name, bool parents) {
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
-    return detail::make_group(detail::h5g_create2(static_cast<Derivate*>(this)->getId(),
-                                                  group_name.c_str(),
-                                                  lcpl.getId(),
-                                                  H5P_DEFAULT,
-                                                  H5P_DEFAULT));
+    auto group = detail::make_group(detail::h5g_create2(static_cast<Derivate*>(this)->getId(),
+                                                        group_name.c_str(),
+                                                        lcpl.getId(),
+                                                        H5P_DEFAULT,
+                                                        H5P_DEFAULT));
+    _cache_object(group_name, group.getId());
+    return group;
 }
 
 template <typename Derivate>
@@ -105,20 +240,196 @@ inline Group NodeTraits<Derivate>::createGroup(const std::string& group_name,
                                                bool parents) {
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
-    return detail::make_group(detail::h5g_create2(static_cast<Derivate*>(this)->getId(),
-                                                  group_name.c_str(),
-                                                  lcpl.getId(),
-                                                  createProps.getId(),
-                                                  H5P_DEFAULT));
+    auto group = detail::make_group(detail::h5g_create2(static_cast<Derivate*>(this)->getId(),
+                                                        group_name.c_str(),
+                                                        lcpl.getId(),
+                                                        createProps.getId(),
+                                                        H5P_DEFAULT));
+    _cache_object(group_name, group.getId());
+    return group;
 }
 
 template <typename Derivate>
 inline Group NodeTraits<Derivate>::getGroup(const std::string& group_name) const {
+    if (_path_cache) {
+        auto key = details::PathCache::key(group_name);
+        hid_t hid = _path_cache->acquire(key);
+        if (hid != H5I_INVALID_HID) {
+            if (detail::h5i_get_type(hid) == H5I_GROUP) {
+                return detail::make_group(hid);
+            }
+            detail::nothrow::h5i_dec_ref(hid);
+        }
+
+        Group parent;
+        std::string leaf;
+        if (hid == H5I_INVALID_HID && _resolve_parent(key, parent, leaf) == PathStatus::Found &&
+            detail::nothrow::h5l_exists(parent.getId(), leaf.c_str(), H5P_DEFAULT) > 0) {
+            auto group = detail::make_group(
+                detail::h5g_open2(parent.getId(), leaf.c_str(), H5P_DEFAULT));
+            _path_cache->insert(key, group.getId());
+            return group;
+        }
+    }
+
     return detail::make_group(detail::h5g_open2(static_cast<const Derivate*>(this)->getId(),
                                                 group_name.c_str(),
                                                 H5P_DEFAULT));
 }
 
+template <typename Derivate>
+inline void NodeTraits<Derivate>::createGroups(std::vector<std::string> group_names,
+                                               const GroupCreateProps& createProps) {
+    const hid_t id = static_cast<const Derivate*>(this)->getId();
+
+    for (auto& name: group_names) {
+        name = details::PathCache::key(name);
+    }
+    std::sort(group_names.begin(), group_names.end());
+    group_names.erase(std::unique(group_names.begin(), group_names.end()), group_names.end());
+
+    // The open groups along the path of the previously created group. Due to
+    // sorting, the next path likely shares a prefix with it.
+    std::vector<std::pair<std::string, Group>> open_groups;
+    Group root;
+
+    for (const auto& key: group_names) {
+        if (key.empty() || key == "/") {
+            throw GroupException("Unable to create the group \"" + key + "\": it already exists");
+        }
+
+        const bool absolute = key[0] == '/';
+        while (!open_groups.empty()) {
+            const auto& prefix = open_groups.back().first;
+            if (key.size() > prefix.size() && key.compare(0, prefix.size(), prefix) == 0 &&
+                key[prefix.size()] == '/') {
+                break;
+            }
+            open_groups.pop_back();
+        }
+
+        size_t begin = open_groups.empty() ? (absolute ? 1 : 0)
+                                           : open_groups.back().first.size() + 1;
+        while (true) {
+            size_t end = std::min(key.find('/', begin), key.size());
+            auto name = key.substr(begin, end - begin);
+
+            hid_t parent_id = id;
+            if (!open_groups.empty()) {
+                parent_id = open_groups.back().second.getId();
+            } else if (absolute) {
+                if (!root.isValid()) {
+                    root = detail::make_group(detail::h5g_open2(id, "/", H5P_DEFAULT));
+                }
+                parent_id = root.getId();
+            }
+
+            const bool is_leaf = end == key.size();
+            hid_t group_id = H5I_INVALID_HID;
+            if (is_leaf) {
+                group_id = detail::h5g_create2(
+                    parent_id, name.c_str(), H5P_DEFAULT, createProps.getId(), H5P_DEFAULT);
+            } else if (detail::nothrow::h5l_exists(parent_id, name.c_str(), H5P_DEFAULT) > 0) {
+                group_id = detail::h5g_open2(parent_id, name.c_str(), H5P_DEFAULT);
+            } else {
+                group_id = detail::h5g_create2(
+                    parent_id, name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            }
+            open_groups.emplace_back(key.substr(0, end), detail::make_group(group_id));
+
+            if (is_leaf) {
+                _cache_object(key, group_id);
+                break;
+            }
+            begin = end + 1;
+        }
+    }
+}
+
+template <typename Derivate>
+inline CreationContext<Derivate> NodeTraits<Derivate>::prepareCreation(
+    const DataSetCreateProps& createProps,
+    const DataSetAccessProps& accessProps,
+    const GroupCreateProps& groupCreateProps,
+    bool parents) const {
+    return CreationContext<Derivate>(
+        *static_cast<const Derivate*>(this), createProps, accessProps, groupCreateProps, parents);
+}
+
+template <typename Derivate>
+inline CreationContext<Derivate>::CreationContext(const Derivate& node,
+                                                  const DataSetCreateProps& createProps,
+                                                  const DataSetAccessProps& accessProps,
+                                                  const GroupCreateProps& groupCreateProps,
+                                                  bool parents)
+    : _node(node)
+    , _dcpl(createProps)
+    , _dapl(accessProps)
+    , _gcpl(groupCreateProps) {
+    _lcpl.add(CreateIntermediateGroup(parents));
+}
+
+template <typename Derivate>
+template <typename T>
+inline const DataType& CreationContext<Derivate>::_get_datatype() {
+    auto it = _datatypes.find(std::type_index(typeid(T)));
+    if (it == _datatypes.end()) {
+        it = _datatypes.emplace(std::type_index(typeid(T)), create_and_check_datatype<T>()).first;
+    }
+    return it->second;
+}
+
+template <typename Derivate>
+inline const DataSpace& CreationContext<Derivate>::_get_space(const std::vector<size_t>& dims) {
+    auto it = _spaces.find(dims);
+    if (it == _spaces.end()) {
+        it = _spaces.emplace(dims, DataSpace(dims)).first;
+    }
+    return it->second;
+}
+
+template <typename Derivate>
+inline DataSet CreationContext<Derivate>::createDataSet(const std::string& dataset_name,
+                                                        const DataSpace& space,
+                                                        const DataType& dtype) {
+    DataSet dataset(detail::h5d_create2(_node.getId(),
+                                        dataset_name.c_str(),
+                                        dtype.getId(),
+                                        space.getId(),
+                                        _lcpl.getId(),
+                                        _dcpl.getId(),
+                                        _dapl.getId()));
+    _node._cache_object(dataset_name, dataset.getId());
+    return dataset;
+}
+
+template <typename Derivate>
+template <typename T>
+inline DataSet CreationContext<Derivate>::createDataSet(const std::string& dataset_name,
+                                                        const DataSpace& space) {
+    return createDataSet(dataset_name, space, _get_datatype<T>());
+}
+
+template <typename Derivate>
+template <typename T>
+inline DataSet CreationContext<Derivate>::createDataSet(const std::string& dataset_name,
+                                                        const T& data) {
+    using base_type = typename details::inspector<T>::base_type;
+    DataSet dataset = createDataSet(dataset_name,
+                                    _get_space(details::inspector<T>::getDimensions(data)),
+                                    _get_datatype<base_type>());
+    dataset.write(data);
+    return dataset;
+}
+
+template <typename Derivate>
+inline Group CreationContext<Derivate>::createGroup(const std::string& group_name) {
+    auto group = detail::make_group(detail::h5g_create2(
+        _node.getId(), group_name.c_str(), _lcpl.getId(), _gcpl.getId(), H5P_DEFAULT));
+    _node._cache_object(group_name, group.getId());
+    return group;
+}
+
 template <typename Derivate>
 inline DataType NodeTraits<Derivate>::getDataType(const std::string& type_name,
                                                   const DataTypeAccessProps& accessProps) const {
@@ -152,6 +463,8 @@ template <typename Derivate>
 inline bool NodeTraits<Derivate>::rename(const std::string& src_path,
                                          const std::string& dst_path,
                                          bool parents) const {
+    clearPathCache();
+
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
     herr_t err = detail::h5l_move(static_cast<const Derivate*>(this)->getId(),
@@ -181,6 +494,108 @@ inline std::vector<std::string> NodeTraits<Derivate>::listObjectNames(IndexType
     return names;
 }
 
+template <typename Derivate>
+inline ObjectNameRange NodeTraits<Derivate>::iterateObjectNames(IndexType idx_type) const {
+    return ObjectNameRange(static_cast<const Derivate*>(this)->getId(), idx_type);
+}
+
+template <typename Derivate>
+inline void NodeTraits<Derivate>::enablePathCache(size_t capacity) {
+    _path_cache = std::make_shared<details::PathCache>(capacity);
+}
+
+template <typename Derivate>
+inline void NodeTraits<Derivate>::disablePathCache() {
+    _path_cache.reset();
+}
+
+template <typename Derivate>
+inline void NodeTraits<Derivate>::clearPathCache() const {
+    if (_path_cache) {
+        _path_cache->clear();
+    }
+}
+
+template <typename Derivate>
+inline void NodeTraits<Derivate>::_cache_object(const std::string& path, hid_t hid) const {
+    if (_path_cache) {
+        auto key = details::PathCache::key(path);
+        if (!key.empty() && key != "/") {
+            _path_cache->insert(key, hid);
+        }
+    }
+}
+
+template <typename Derivate>
+inline auto NodeTraits<Derivate>::_resolve_parent(const std::string& key,
+                                                  Group& parent,
+                                                  std::string& leaf) const -> PathStatus {
+    const hid_t id = static_cast<const Derivate*>(this)->getId();
+    const bool absolute = key[0] == '/';
+
+    // The end of every component, except the last.
+    std::vector<size_t> ends;
+    for (size_t pos = key.find('/', 1); pos != std::string::npos; pos = key.find('/', pos + 1)) {
+        ends.push_back(pos);
+    }
+    const size_t leaf_begin = ends.empty() ? (absolute ? 1 : 0) : ends.back() + 1;
+    leaf = key.substr(leaf_begin);
+
+    // Start from the closest cached ancestor, or the root / this group. The
+    // cache hands out new references.
+    size_t i = ends.size();
+    hid_t start = H5I_INVALID_HID;
+    while (i > 0 &&
+           (start = _path_cache->acquire(key.substr(0, ends[i - 1]))) == H5I_INVALID_HID) {
+        --i;
+    }
+
+    Group current;
+    if (start != H5I_INVALID_HID) {
+        current = detail::make_group(start);
+        // The cache holds datasets too, which have no children.
+        if (detail::h5i_get_type(start) != H5I_GROUP) {
+            return PathStatus::Missing;
+        }
+    } else if (!absolute) {
+        detail::h5i_inc_ref(id);
+        current = detail::make_group(id);
+    } else if ((start = _path_cache->acquire("/")) != H5I_INVALID_HID) {
+        current = detail::make_group(start);
+    } else {
+        current = detail::make_group(detail::h5o_open(id, "/", H5P_DEFAULT));
+        _path_cache->insert("/", current.getId());
+    }
+
+    for (; i < ends.size(); ++i) {
+        size_t begin = i == 0 ? (absolute ? 1 : 0) : ends[i - 1] + 1;
+        auto name = key.substr(begin, ends[i] - begin);
+
+        auto exists = detail::nothrow::h5l_exists(current.getId(), name.c_str(), H5P_DEFAULT);
+        if (exists <= 0) {
+            return exists < 0 ? PathStatus::Unresolved : PathStatus::Missing;
+        }
+
+        // Following anything but hard links can fail, e.g. dangling links.
+        H5L_info_t link_info;
+        detail::h5l_get_info(current.getId(), name.c_str(), &link_info, H5P_DEFAULT);
+        if (link_info.type != H5L_TYPE_HARD) {
+            return PathStatus::Unresolved;
+        }
+
+        auto next = detail::make_group(detail::h5o_open(current.getId(), name.c_str(), H5P_DEFAULT));
+        if (detail::h5i_get_type(next.getId()) != H5I_GROUP) {
+            return PathStatus::Missing;
+        }
+
+        _path_cache->insert(key.substr(0, ends[i]), next.getId());
+        current = std::move(next);
+    }
+
+    parent = std::move(current);
+    return PathStatus::Found;
+}
+
 template <typename Derivate>
 inline bool NodeTraits<Derivate>::_exist(const std::string& node_name, bool raise_errors) const {
     SilenceHDF5 silencer{};
@@ -203,6 +618,29 @@ inline bool NodeTraits<Derivate>::_exist(const std::string& node_name, bool rais
 
 template <typename Derivate>
 inline bool NodeTraits<Derivate>::exist(const std::string& group_path) const {
+    if (_path_cache) {
+        auto key = details::PathCache::key(group_path);
+        if (!key.empty() && key != "/") {
+            if (_path_cache->contains(key)) {
+                return true;
+            }
+
+            Group parent;
+            std::string leaf;
+            auto status = _resolve_parent(key, parent, leaf);
+            if (status == PathStatus::Missing) {
+                return false;
+            }
+            if (status == PathStatus::Found) {
+                // Checking a single component in an existing group can't fail.
+                auto val = detail::nothrow::h5l_exists(parent.getId(), leaf.c_str(), H5P_DEFAULT);
+                if (val >= 0) {
+                    return val > 0;
+                }
+            }
+        }
+    }
+
     // When there are slashes, first check everything is fine
     // so that subsequent errors are only due to missing intermediate groups
     if (group_path.find('/') != std::string::npos) {
@@ -216,6 +654,7 @@ inline bool NodeTraits<Derivate>::exist(const std::string& group_path) const {
 
 template <typename Derivate>
 inline void NodeTraits<Derivate>::unlink(const std::string& node_name) const {
+    clearPathCache();
     detail::h5l_delete(static_cast<const Derivate*>(this)->getId(), node_name.c_str(), H5P_DEFAULT);
 }
 
@@ -319,4 +758,187 @@ inline void NodeTraits<Derivate>::createHardLink(const std::string& link_name,
 }
 
 
+namespace details {
+
+static inline ObjectType _convert_object_type(H5O_type_t h5type) noexcept {
+    switch (h5type) {
+    case H5O_TYPE_GROUP:
+        return ObjectType::Group;
+    case H5O_TYPE_DATASET:
+        return ObjectType::Dataset;
+    case H5O_TYPE_NAMED_DATATYPE:
+        return ObjectType::UserDataType;
+    default:
+        return ObjectType::Other;
+    }
+}
+
+template <class F>
+struct HighFiveVisitData {
+    const std::string& prefix;
+    F& callback;
+    VisitFields fields;
+    std::unordered_set<haddr_t>& visited;
+    std::exception_ptr err;
+};
+
+}  // namespace details
+
+template <typename Derivate>
+template <class F>
+inline void NodeTraits<Derivate>::visit(F&& callback, VisitFields fields) const {
+    const hid_t id = static_cast<const Derivate*>(this)->getId();
+
+    detail::h5o_info1_t info;
+    detail::h5o_get_info_by_name_basic(id, ".", &info, H5P_DEFAULT);
+
+    std::unordered_set<haddr_t> visited{info.addr};
+    _visit_group(id, std::string(), callback, fields, visited);
+}
+
+template <typename Derivate>
+template <class F>
+inline void NodeTraits<Derivate>::_visit_group(hid_t group_id,
+                                               const std::string& prefix,
+                                               F& callback,
+                                               VisitFields fields,
+                                               std::unordered_set<haddr_t>& visited) {
+    details::HighFiveVisitData<F> data{prefix, callback, fields, visited, nullptr};
+    detail::h5l_iterate(group_id,
+                        H5_INDEX_NAME,
+                        H5_ITER_INC,
+                        nullptr,
+                        &NodeTraits::_visit_link<F, H5L_info_t>,
+                        static_cast<void*>(&data));
+
+    // Exceptions can't propagate through HDF5, they're stored and rethrown.
+    if (data.err) {
+        std::rethrow_exception(data.err);
+    }
+}
+
+template <typename Derivate>
+template <class F, class InfoType>
+inline herr_t NodeTraits<Derivate>::_visit_link(hid_t group_id,
+                                                const char* name,
+                                                const InfoType* link_info,
+                                                void* op_data) {
+    auto* data = static_cast<details::HighFiveVisitData<F>*>(op_data);
+    try {
+        NodeInfo node;
+        node.path = data->prefix + name;
+        node.link_type = _convert_link_type(link_info->type);
+
+        if (node.link_type == LinkType::Hard) {
+            detail::h5o_info1_t info;
+            detail::h5o_get_info_by_name_basic(group_id, name, &info, H5P_DEFAULT);
+            node.object_type = details::_convert_object_type(info.type);
+            node.address = info.addr;
+
+            if ((data->fields & VisitFields::AttributeNames) != VisitFields::Basic) {
+                details::HighFiveIterateData iterate_data(node.attribute_names);
+                detail::h5a_iterate_by_name(group_id,
+                                            name,
+                                            H5_INDEX_NAME,
+                                            H5_ITER_INC,
+                                            nullptr,
+                                            &details::internal_high_five_iterate<H5A_info_t>,
+                                            static_cast<void*>(&iterate_data),
+                                            H5P_DEFAULT);
+            }
+        }
+
+        bool needs_dataset = (data->fields & (VisitFields::Dimensions | VisitFields::DataType)) !=
+                             VisitFields::Basic;
+        if (node.object_type == ObjectType::Dataset && needs_dataset) {
+            DataSet dataset(detail::h5d_open2(group_id, name, H5P_DEFAULT));
+            if ((data->fields & VisitFields::Dimensions) != VisitFields::Basic) {
+                node.dimensions = dataset.getDimensions();
+            }
+            if ((data->fields & VisitFields::DataType) != VisitFields::Basic) {
+                node.data_type = dataset.getDataType();
+            }
+        }
+
+        data->callback(static_cast<const NodeInfo&>(node));
+
+        // Every group is visited once, even if there are multiple hard links to it.
+        if (node.object_type == ObjectType::Group && data->visited.insert(node.address).second) {
+            auto group = detail::make_group(detail::h5g_open2(group_id, name, H5P_DEFAULT));
+            _visit_group(group.getId(), node.path + "/", data->callback, data->fields, data->visited);
+        }
+        return 0;
+    } catch (...) {
+        data->err = std::current_exception();
+    }
+
+    // A positive value stops the iteration without raising an HDF5 error.
+    return 1;
+}
+
+inline ObjectNameIterator::ObjectNameIterator(hid_t group_id, H5_index_t idx_type, bool is_end)
+    : _group_id(group_id)
+    , _idx_type(idx_type)
+    , _batch_size(details::object_name_min_batch)
+    , _is_end(is_end) {
+    if (!_is_end) {
+        fetch();
+    }
+}
+
+inline void ObjectNameIterator::fetch() {
+    _names.clear();
+    _position = 0;
+    if (!_is_complete) {
+        // `H5Literate` resumes at `_next`, which it also advances. It returns
+        // zero only once it has passed over all links.
+        details::HighFiveNameBatch batch{_names, _batch_size};
+        _is_complete = detail::h5l_iterate(_group_id,
+                                           _idx_type,
+                                           H5_ITER_INC,
+                                           &_next,
+                                           &details::internal_high_five_name_batch<H5L_info_t>,
+                                           static_cast<void*>(&batch)) == 0;
+        _batch_size = std::min(2 * _batch_size, details::object_name_max_batch);
+    }
+    _is_end = _names.empty();
+}
+
+inline ObjectNameIterator& ObjectNameIterator::operator++() {
+    ++_index;
+    if (++_position == _names.size()) {
+        fetch();
+    }
+    return *this;
+}
+
+inline ObjectNameRange::ObjectNameRange(hid_t group_id, IndexType idx_type)
+    : _group_id(group_id)
+    , _idx_type(idx_type) {
+    detail::h5i_inc_ref(_group_id);
+}
+
+inline ObjectNameRange::ObjectNameRange(const ObjectNameRange& other)
+    : ObjectNameRange(other._group_id, other._idx_type) {}
+
+inline ObjectNameRange::ObjectNameRange(ObjectNameRange&& other) noexcept
+    : _group_id(other._group_id)
+    , _idx_type(other._idx_type) {
+    other._group_id = H5I_INVALID_HID;
+}
+
+inline ObjectNameRange::~ObjectNameRange() {
+    if (_group_id != H5I_INVALID_HID) {
+        detail::nothrow::h5i_dec_ref(_group_id);
+    }
+}
+
+inline ObjectNameIterator ObjectNameRange::begin() const {
+    return ObjectNameIterator(_group_id, static_cast<H5_index_t>(_idx_type), false);
+}
+
+inline ObjectNameIterator ObjectNameRange::end() const {
+    return ObjectNameIterator(_group_id, static_cast<H5_index_t>(_idx_type), true);
+}
+
 }  // namespace HighFive
@@ -48,6 +48,18 @@ inline Object& Object::operator=(const Object& other) {
     return *this;
 }
 
+inline Object& Object::operator=(Object&& other) noexcept {
+    if (this != &other) {
+        if (isValid() && detail::nothrow::h5i_dec_ref(_hid) < 0) {
+            HIGHFIVE_LOG_ERROR("Failed to decrease reference count of HID");
+        }
+
+        _hid = other._hid;
+        other._hid = H5I_INVALID_HID;
+    }
+    return *this;
+}
+
 inline Object::~Object() {
     if (isValid()) {
         if (detail::nothrow::h5i_dec_ref(_hid) < 0) {
@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../H5Exception.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A value which may be missing, e.g. the result of a lookup.
+///
+/// This is the subset of `std::optional` needed by HighFive, which can't use
+/// `std::optional` since it requires C++17.
+///
+/// \since 3.0
+template <typename T>
+class Optional {
+  public:
+    Optional() noexcept {}
+
+    Optional(const T& value) {
+        emplace(value);
+    }
+
+    Optional(T&& value) {
+        emplace(std::move(value));
+    }
+
+    Optional(const Optional& other) {
+        if (other._has_value) {
+            emplace(other._value);
+        }
+    }
+
+    Optional(Optional&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (other._has_value) {
+            emplace(std::move(other._value));
+        }
+    }
+
+    Optional& operator=(const Optional& other) {
+        if (this != &other) {
+            reset();
+            if (other._has_value) {
+                emplace(other._value);
+            }
+        }
+        return *this;
+    }
+
+    Optional& operator=(Optional&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            reset();
+            if (other._has_value) {
+                emplace(std::move(other._value));
+            }
+        }
+        return *this;
+    }
+
+    ~Optional() {
+        reset();
+    }
+
+    ///
+    /// \brief Check if there's a value.
+    ///
+    bool has_value() const noexcept {
+        return _has_value;
+    }
+
+    explicit operator bool() const noexcept {
+        return _has_value;
+    }
+
+    ///
+    /// \brief The value, throws an `Exception` if there's none.
+    ///
+    T& value() {
+        check_value();
+        return _value;
+    }
+
+    const T& value() const {
+        check_value();
+        return _value;
+    }
+
+    ///
+    /// \brief The value, or `default_value` if there's none.
+    ///
+    T value_or(T default_value) const {
+        if (_has_value) {
+            return _value;
+        }
+        return default_value;
+    }
+
+    /// Access the value, which must exist.
+    T& operator*() noexcept {
+        return _value;
+    }
+
+    const T& operator*() const noexcept {
+        return _value;
+    }
+
+    T* operator->() noexcept {
+        return &_value;
+    }
+
+    const T* operator->() const noexcept {
+        return &_value;
+    }
+
+    ///
+    /// \brief Destroy the value, if any.
+    ///
+    void reset() noexcept {
+        if (_has_value) {
+            _value.~T();
+            _has_value = false;
+        }
+    }
+
+  private:
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        new (&_value) T(std::forward<Args>(args)...);
+        _has_value = true;
+    }
+
+    void check_value() const {
+        if (!_has_value) {
+            throw Exception("Unable to access the value of an empty Optional.");
+        }
+    }
+
+    union {
+        T _value;
+    };
+    bool _has_value = false;
+};
+
+}  // namespace HighFive
@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <bitset>
+#include <cstring>
+
+#include "../H5PackedBits.hpp"
+#include "pack_bits.hpp"
+
+namespace HighFive {
+
+static_assert(sizeof(bool) == 1, "Packing bits assumes that `bool` is one byte.");
+
+namespace details {
+constexpr char packed_bits_count_attribute[] = "highfive_bit_count";
+}  // namespace details
+
+inline PackedBits::PackedBits(size_t n_bits, bool value)
+    : _bytes((n_bits + 7) / 8, value ? uint8_t(0xff) : uint8_t(0))
+    , _size(n_bits) {
+    clearUnusedBits();
+}
+
+inline PackedBits::PackedBits(const std::vector<bool>& values)
+    : _bytes((values.size() + 7) / 8)
+    , _size(values.size()) {
+    details::vector_bool_to_bits(values, _bytes.data());
+}
+
+inline PackedBits::PackedBits(const bool* values, size_t n_bits)
+    : _bytes((n_bits + 7) / 8)
+    , _size(n_bits) {
+    details::pack_bits(reinterpret_cast<const uint8_t*>(values), n_bits, _bytes.data());
+}
+
+template <class Node>
+inline DataSet PackedBits::create(Node& node,
+                                  const std::string& name,
+                                  const PackedBits& bits,
+                                  const DataSetCreateProps& create_props) {
+    auto dataset = node.createDataSet(name, bits, create_props);
+    dataset.createAttribute(details::packed_bits_count_attribute, uint64_t(bits.size()));
+    return dataset;
+}
+
+inline PackedBits PackedBits::read(const DataSet& dataset, const DataTransferProps& xfer_props) {
+    PackedBits bits;
+    dataset.read(bits, xfer_props);
+    if (dataset.hasAttribute(details::packed_bits_count_attribute)) {
+        const auto n_bits = dataset.getAttribute(details::packed_bits_count_attribute)
+                                .read<uint64_t>();
+        if (n_bits > bits.size() || n_bits + 8 <= bits.size()) {
+            throw DataSetException("The bit count " + std::to_string(n_bits) +
+                                   " doesn't match the " + std::to_string(bits.getByteSize()) +
+                                   " bytes of the dataset.");
+        }
+        bits.resize(static_cast<size_t>(n_bits));
+    }
+    return bits;
+}
+
+inline void PackedBits::resize(size_t n_bits) {
+    _bytes.resize((n_bits + 7) / 8, 0);
+    _size = n_bits;
+    clearUnusedBits();
+}
+
+inline void PackedBits::set(size_t i, bool value) {
+    const auto mask = static_cast<uint8_t>(1u << (i % 8));
+    _bytes[i / 8] = static_cast<uint8_t>(value ? _bytes[i / 8] | mask : _bytes[i / 8] & ~mask);
+}
+
+inline size_t PackedBits::count() const noexcept {
+    size_t n = 0;
+    size_t i = 0;
+    for (; i + 8 <= _bytes.size(); i += 8) {
+        uint64_t word;
+        std::memcpy(&word, _bytes.data() + i, sizeof(word));
+        n += std::bitset<64>(word).count();
+    }
+    for (; i < _bytes.size(); ++i) {
+        n += std::bitset<8>(_bytes[i]).count();
+    }
+    return n;
+}
+
+inline std::vector<bool> PackedBits::toVector() const {
+    std::vector<bool> values(_size);
+    details::bits_to_vector_bool(_bytes.data(), values);
+    return values;
+}
+
+inline void PackedBits::unpack(bool* values) const {
+    details::unpack_bits(_bytes.data(), _size, reinterpret_cast<uint8_t*>(values));
+}
+
+inline void PackedBits::clearUnusedBits() {
+    if (_size % 8 != 0) {
+        _bytes.back() = static_cast<uint8_t>(_bytes.back() & ((1u << (_size % 8)) - 1u));
+    }
+}
+
+}  // namespace HighFive
@@ -0,0 +1,142 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <H5Ipublic.h>
+
+#include "h5i_wrapper.hpp"
+
+namespace HighFive {
+namespace details {
+
+// A bounded map from paths to open object handles, which evicts the least
+// recently used handle. It owns one reference to every handle it holds.
+//
+// Lookups reorder the entries, hence every member is guarded by a mutex: the
+// const methods of a node may use the cache from several threads.
+class PathCache {
+  public:
+    explicit PathCache(size_t capacity)
+        : _capacity(capacity) {}
+
+    PathCache(const PathCache&) = delete;
+    PathCache& operator=(const PathCache&) = delete;
+
+    ~PathCache() {
+        clear();
+    }
+
+    // The canonical form of `path` used as key: repeated and trailing slashes,
+    // as well as `.` components, are removed. A leading slash is kept.
+    static std::string key(const std::string& path) {
+        std::string key = !path.empty() && path[0] == '/' ? "/" : "";
+        size_t begin = 0;
+        while (begin < path.size()) {
+            size_t end = std::min(path.find('/', begin), path.size());
+            bool is_dot = end - begin == 1 && path[begin] == '.';
+            if (end > begin && !is_dot) {
+                if (!key.empty() && key.back() != '/') {
+                    key += '/';
+                }
+                key.append(path, begin, end - begin);
+            }
+            begin = end + 1;
+        }
+        return key;
+    }
+
+    // Returns a new reference to the handle cached for `key`, which the caller
+    // must release, or `H5I_INVALID_HID` if `key` isn't cached. The reference
+    // is taken under the lock, i.e. the handle can't be evicted before.
+    hid_t acquire(const std::string& key) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = touch(key);
+        if (it == _entries.end()) {
+            return H5I_INVALID_HID;
+        }
+
+        detail::h5i_inc_ref(it->second);
+        return it->second;
+    }
+
+    bool contains(const std::string& key) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return touch(key) != _entries.end();
+    }
+
+    void insert(const std::string& key, hid_t hid) {
+        if (_capacity == 0) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _index.find(key);
+        if (it != _index.end()) {
+            erase(it->second);
+        }
+
+        detail::h5i_inc_ref(hid);
+        _entries.emplace_front(key, hid);
+        _index[key] = _entries.begin();
+
+        while (_entries.size() > _capacity) {
+            erase(std::prev(_entries.end()));
+        }
+    }
+
+    void clear() noexcept {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& entry: _entries) {
+            detail::nothrow::h5i_dec_ref(entry.second);
+        }
+        _entries.clear();
+        _index.clear();
+    }
+
+    size_t size() const noexcept {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _entries.size();
+    }
+
+  private:
+    using entries_t = std::list<std::pair<std::string, hid_t>>;
+
+    // Marks `key` as the most recently used entry. Requires the lock.
+    entries_t::iterator touch(const std::string& key) {
+        auto it = _index.find(key);
+        if (it == _index.end()) {
+            return _entries.end();
+        }
+
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return it->second;
+    }
+
+    void erase(entries_t::iterator it) noexcept {
+        detail::nothrow::h5i_dec_ref(it->second);
+        _index.erase(it->first);
+        _entries.erase(it);
+    }
+
+    size_t _capacity;
+    mutable std::mutex _mutex;
+    entries_t _entries;
+    std::unordered_map<std::string, entries_t::iterator> _index;
+};
+
+}  // namespace details
+}  // namespace HighFive
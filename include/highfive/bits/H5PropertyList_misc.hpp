@@ -254,6 +254,53 @@ inline hsize_t MetadataBlockSize::getSize() const {
     return _size;
 }
 
+namespace detail {
+inline H5AC_cache_config_t default_mdc_config() {
+    H5AC_cache_config_t config;
+    config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    detail::h5p_get_mdc_config(H5P_FILE_ACCESS_DEFAULT, &config);
+    return config;
+}
+}  // namespace detail
+
+inline MetadataCacheConfig::MetadataCacheConfig(size_t initial_size,
+                                                size_t min_size,
+                                                size_t max_size)
+    : _config(detail::default_mdc_config()) {
+    _config.set_initial_size = true;
+    _config.initial_size = initial_size;
+    _config.min_size = min_size;
+    _config.max_size = max_size;
+}
+
+inline MetadataCacheConfig::MetadataCacheConfig(const H5AC_cache_config_t& config)
+    : _config(config) {}
+
+inline MetadataCacheConfig::MetadataCacheConfig(const FileAccessProps& fapl) {
+    _config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+    detail::h5p_get_mdc_config(fapl.getId(), &_config);
+}
+
+inline void MetadataCacheConfig::apply(const hid_t list) const {
+    detail::h5p_set_mdc_config(list, &_config);
+}
+
+inline size_t MetadataCacheConfig::getInitialSize() const {
+    return _config.initial_size;
+}
+
+inline size_t MetadataCacheConfig::getMinSize() const {
+    return _config.min_size;
+}
+
+inline size_t MetadataCacheConfig::getMaxSize() const {
+    return _config.max_size;
+}
+
+inline const H5AC_cache_config_t& MetadataCacheConfig::getConfig() const {
+    return _config;
+}
+
 inline void EstimatedLinkInfo::apply(const hid_t hid) const {
     detail::h5p_set_est_link_info(hid, _entries, _length);
 }
@@ -358,10 +405,29 @@ inline H5D_alloc_time_t AllocationTime::getAllocationTime() {
     return _alloc_time;
 }
 
+inline FillTime::FillTime(H5D_fill_time_t fill_time)
+    : _fill_time(fill_time) {}
+
+inline FillTime::FillTime(const DataSetCreateProps& dcpl) {
+    detail::h5p_get_fill_time(dcpl.getId(), &_fill_time);
+}
+
+inline void FillTime::apply(hid_t dcpl) const {
+    detail::h5p_set_fill_time(dcpl, _fill_time);
+}
+
+inline H5D_fill_time_t FillTime::getFillTime() const {
+    return _fill_time;
+}
+
 inline Caching::Caching(const DataSetCreateProps& dcpl) {
     detail::h5p_get_chunk_cache(dcpl.getId(), &_numSlots, &_cacheSize, &_w0);
 }
 
+inline Caching::Caching(const DataSetAccessProps& dapl) {
+    detail::h5p_get_chunk_cache(dapl.getId(), &_numSlots, &_cacheSize, &_w0);
+}
+
 inline void Caching::apply(const hid_t hid) const {
     detail::h5p_set_chunk_cache(hid, _numSlots, _cacheSize, _w0);
 }
@@ -403,6 +469,84 @@ inline bool CreateIntermediateGroup::isSet() const {
     return _create;
 }
 
+inline TypeConversionBuffer::TypeConversionBuffer(size_t size,
+                                                  void* conversion_buffer,
+                                                  void* background_buffer)
+    : _size(size)
+    , _conversion_buffer(conversion_buffer)
+    , _background_buffer(background_buffer) {}
+
+inline TypeConversionBuffer::TypeConversionBuffer(const DataTransferProps& dxpl) {
+    _size = detail::h5p_get_buffer(dxpl.getId(), &_conversion_buffer, &_background_buffer);
+}
+
+inline void TypeConversionBuffer::apply(const hid_t hid) const {
+    detail::h5p_set_buffer(hid, _size, _conversion_buffer, _background_buffer);
+}
+
+inline size_t TypeConversionBuffer::getSize() const {
+    return _size;
+}
+
+inline void* TypeConversionBuffer::getConversionBuffer() const {
+    return _conversion_buffer;
+}
+
+inline void* TypeConversionBuffer::getBackgroundBuffer() const {
+    return _background_buffer;
+}
+
+inline HyperslabVectorSize::HyperslabVectorSize(size_t size)
+    : _size(size) {}
+
+inline HyperslabVectorSize::HyperslabVectorSize(const DataTransferProps& dxpl) {
+    detail::h5p_get_hyper_vector_size(dxpl.getId(), &_size);
+}
+
+inline void HyperslabVectorSize::apply(const hid_t hid) const {
+    detail::h5p_set_hyper_vector_size(hid, _size);
+}
+
+inline size_t HyperslabVectorSize::getSize() const {
+    return _size;
+}
+
+inline AutoTransferBuffers::AutoTransferBuffers(size_t max_buffer_size)
+    : _max_buffer_size(max_buffer_size) {}
+
+inline AutoTransferBuffers::AutoTransferBuffers(const DataTransferProps& dxpl)
+    : _max_buffer_size(0) {
+    if (dxpl.getId() != H5P_DEFAULT && isAdded().load(std::memory_order_relaxed) &&
+        detail::h5p_exist(dxpl.getId(), property_name) > 0) {
+        detail::h5p_get(dxpl.getId(), property_name, &_max_buffer_size);
+    }
+}
+
+inline void AutoTransferBuffers::apply(const hid_t hid) const {
+    isAdded().store(true, std::memory_order_relaxed);
+
+    // The property isn't known to HDF5, it's added to this list only.
+    if (detail::h5p_exist(hid, property_name) > 0) {
+        detail::h5p_set(hid, property_name, &_max_buffer_size);
+    } else {
+        size_t value = _max_buffer_size;
+        detail::h5p_insert2(hid, property_name, sizeof(value), &value);
+    }
+}
+
+inline std::atomic<bool>& AutoTransferBuffers::isAdded() noexcept {
+    static std::atomic<bool> is_added{false};
+    return is_added;
+}
+
+inline size_t AutoTransferBuffers::getMaxBufferSize() const {
+    return _max_buffer_size;
+}
+
+inline bool AutoTransferBuffers::isEnabled() const {
+    return _max_buffer_size != 0;
+}
+
 #ifdef H5_HAVE_PARALLEL
 inline UseCollectiveIO::UseCollectiveIO(bool enable)
     : _enable(enable) {}
@@ -94,7 +94,7 @@ inline void enforce_ascii_hack(const DataType& dst, const DataType& src) {
 
 template <>
 struct string_type_checker<void> {
-    inline static DataType getDataType(const DataType& element_type, const DataType& dtype) {
+    inline static DataType getDataType(DataType element_type, const DataType& dtype) {
         if (detail::h5t_get_class(element_type.getId()) == H5T_STRING) {
             enforce_ascii_hack(element_type, dtype);
         }
@@ -8,14 +8,14 @@
  */
 #pragma once
 
+#include <utility>
+
 namespace HighFive {
 
-inline Selection::Selection(const DataSpace& memspace,
-                            const DataSpace& file_space,
-                            const DataSet& set)
-    : _mem_space(memspace)
-    , _file_space(file_space)
-    , _set(set) {}
+inline Selection::Selection(DataSpace memspace, DataSpace file_space, DataSet set)
+    : _mem_space(std::move(memspace))
+    , _file_space(std::move(file_space))
+    , _set(std::move(set)) {}
 
 inline DataSpace Selection::getSpace() const {
     return _file_space;
@@ -39,10 +39,8 @@ inline const DataType Selection::getDataType() const {
 }
 
 namespace detail {
-inline Selection make_selection(const DataSpace& mem_space,
-                                const DataSpace& file_space,
-                                const DataSet& set) {
-    return Selection(mem_space, file_space, set);
+inline Selection make_selection(DataSpace mem_space, DataSpace file_space, DataSet set) {
+    return Selection(std::move(mem_space), std::move(file_space), std::move(set));
 }
 }  // namespace detail
 
@@ -0,0 +1,74 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+// SIMD kernels are written with intrinsics and compiled with per-function
+// target attributes, such that the library can pick them at runtime.
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define HIGHFIVE_SIMD_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace HighFive {
+
+///
+/// \brief The instruction sets the vectorized kernels can use.
+///
+/// \since 3.0
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    /// AVX2. Half precision floats additionally need F16C, without it they're
+    /// converted by the scalar kernels.
+    AVX2,
+    /// AVX-512F.
+    AVX512,
+};
+
+///
+/// \brief The most capable `SimdLevel` supported by this CPU and compiler.
+///
+/// SIMD is only available on x86-64 with GCC or Clang, elsewhere this is
+/// `SimdLevel::Scalar`.
+///
+/// \since 3.0
+inline SimdLevel get_supported_simd_level() {
+#ifdef HIGHFIVE_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+    return SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+namespace details {
+
+// Whether the CPU converts half precision floats, i.e. supports F16C. AVX2
+// doesn't imply it.
+inline bool cpu_supports_f16c() {
+#ifdef HIGHFIVE_SIMD_X86
+    static const bool supported = []() {
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        return __get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & bit_F16C) != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+}  // namespace details
+}  // namespace HighFive
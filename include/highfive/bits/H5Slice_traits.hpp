@@ -415,6 +415,76 @@ class ProductSet {
     friend class SliceTraits;
 };
 
+/// \brief Whether a transfer reads from or writes to the file.
+enum class TransferDirection { Read, Write };
+
+/// \brief The kind of selection in the file.
+enum class SelectionType { None, Points, Hyperslabs, All };
+
+///
+/// \brief How HDF5 converts between the memory and file datatype.
+///
+/// `Hard` conversions are compiled functions, `Soft` conversions are
+/// generic, and usually much slower, conversions done by the library.
+enum class ConversionPath { None, Hard, Soft };
+
+/// \brief How HighFive moves data between the container and the HDF5 buffer.
+enum class CopyMode {
+    /// The container is passed to HDF5 as is, no copy is made.
+    Shallow,
+    /// The elements are copied into, or out of, a contiguous buffer.
+    Deep,
+    /// Strings are copied into, or out of, a buffer of fixed or variable
+    /// length strings.
+    String
+};
+
+///
+/// \brief A description of a planned read or write, see `SliceTraits::explain`.
+///
+/// Nothing is read or written to produce the report. Useful to understand why
+/// a transfer is slow, e.g. because it touches many chunks or needs a soft
+/// type conversion.
+///
+/// \since 3.0
+struct TransferReport {
+    /// The kind of selection in the file.
+    SelectionType selection_type = SelectionType::None;
+    /// Number of blocks of a hyperslab selection, or points of a point selection.
+    size_t n_blocks = 0;
+    /// Number of elements transferred.
+    size_t n_elements = 0;
+
+    /// Whether the dataset is chunked.
+    bool is_chunked = false;
+    /// Number of allocated chunks which intersect the selection.
+    size_t n_chunks = 0;
+    /// Number of bytes these chunks occupy in the file.
+    uint64_t chunk_bytes = 0;
+    /// Whether `n_chunks` and `chunk_bytes` only count the chunks which
+    /// intersect the selection. Either the allocated chunks are listed, or the
+    /// chunks in the bounding box of the selection are looked up by their
+    /// coordinates. Before HDF5 1.12.3, listing is quadratic in the number of
+    /// chunks; if there are more than 4096 allocated chunks and more than
+    /// 65536 chunks in the bounding box, all allocated chunks of the dataset
+    /// are counted instead and this is `false`.
+    bool is_chunk_count_exact = true;
+
+    /// The conversion from the file to the memory datatype, or vice versa.
+    ConversionPath conversion = ConversionPath::None;
+    /// How the container is copied to, or from, the HDF5 buffer.
+    CopyMode copy_mode = CopyMode::Shallow;
+
+    /// Bytes allocated by HighFive for the buffer passed to HDF5.
+    size_t converter_bytes = 0;
+    /// Upper bound of the bytes HDF5 needs to convert the datatype, limited by
+    /// the type conversion buffer of the transfer properties.
+    size_t conversion_bytes = 0;
+    /// Number of I/O vectors HDF5 builds at once for a hyperslab selection,
+    /// see `HyperslabVectorSize`.
+    size_t hyper_vector_size = 0;
+};
+
 
 template <typename Derivate>
 class SliceTraits {
@@ -551,6 +621,43 @@ class SliceTraits {
     template <typename T>
     void write_raw(const T* buffer, const DataTransferProps& xfer_props = DataTransferProps());
 
+    ///
+    /// \brief Set every selected element to `value`.
+    ///
+    /// No buffer of the size of the selection is needed. Instead, a buffer
+    /// for one block is filled with `H5Dfill` and written once per block that
+    /// intersects the selection. For chunked datasets the blocks are the
+    /// chunks, otherwise slabs of roughly 1 MiB.
+    ///
+    /// \param value: A single element, e.g. a `double`.
+    /// \param xfer_props: The HDF5 data transfer properties.
+    ///
+    /// \since 3.0
+    template <typename T>
+    void fill(const T& value, const DataTransferProps& xfer_props = DataTransferProps());
+
+    ///
+    /// \brief Describe a `read` or `write` of a `T` without performing it.
+    ///
+    /// The report contains the type and size of the selection, the chunks
+    /// touched, whether HDF5 needs to convert the datatype and how much
+    /// scratch memory the transfer needs.
+    ///
+    /// \code{.cpp}
+    /// auto report = dataset.select({0, 0}, {100, 10}).explain<std::vector<float>>();
+    /// if (report.conversion == ConversionPath::Soft) {
+    ///     // ...
+    /// }
+    /// \endcode
+    ///
+    /// \param direction: Whether to describe a read or a write.
+    /// \param xfer_props: The HDF5 data transfer properties of the transfer.
+    ///
+    /// \since 3.0
+    template <typename T>
+    TransferReport explain(TransferDirection direction = TransferDirection::Read,
+                           const DataTransferProps& xfer_props = DataTransferProps()) const;
+
     ///
     /// \brief Return a `Selection` with `axes` squeezed from the memspace.
     ///
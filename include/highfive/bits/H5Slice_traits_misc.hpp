@@ -9,17 +9,22 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "h5d_wrapper.hpp"
+#include "h5p_wrapper.hpp"
 #include "h5s_wrapper.hpp"
+#include "h5t_wrapper.hpp"
 
 #include "H5ReadWrite_misc.hpp"
 #include "H5Converter_misc.hpp"
+#include "H5VlenArena.hpp"
 #include "squeeze.hpp"
 #include "compute_total_size.hpp"
 #include "assert_compatible_spaces.hpp"
@@ -39,16 +44,43 @@ inline const DataSet& get_dataset(const DataSet& ds) {
     return ds;
 }
 
+// map the correct memspace depending of the layout, the spaces of a
+// selection are borrowed, i.e. the handles aren't copied
+// dataset -> a new handle to its dataspace
+// subselection -> its memspace
+inline const DataSpace& get_mem_space(const Selection& sel) {
+    return sel._mem_space;
+}
+
+inline DataSpace get_mem_space(const DataSet& ds) {
+    return ds.getMemSpace();
+}
+
+inline const DataSpace& get_file_space(const Selection& sel) {
+    return sel._file_space;
+}
+
 // map the correct memspace identifier depending of the layout
 // dataset -> entire memspace
 // selection -> resolve space id
 inline hid_t get_memspace_id(const Selection& ptr) {
-    return ptr.getMemSpace().getId();
+    return get_mem_space(ptr).getId();
 }
 
 inline hid_t get_memspace_id(const DataSet&) {
     return H5S_ALL;
 }
+
+// map the correct filespace identifier depending of the layout
+// dataset -> entire filespace
+// selection -> resolve space id
+inline hid_t get_file_space_id(const Selection& ptr) {
+    return get_file_space(ptr).getId();
+}
+
+inline hid_t get_file_space_id(const DataSet&) {
+    return H5S_ALL;
+}
 }  // namespace details
 
 inline ElementSet::ElementSet(std::initializer_list<std::size_t> list)
@@ -213,6 +245,114 @@ inline ProductSet::ProductSet(const Slices&... slices) {
 }
 
 
+namespace detail {
+// The transfer properties to read or write `slice` with. If `xfer_props`
+// requests `AutoTransferBuffers`, `tuned` receives a copy of `xfer_props` with
+// buffers sized for this transfer.
+template <class Derivate>
+inline hid_t tune_transfer(const Derivate& slice,
+                           hid_t mem_type_id,
+                           const DataTransferProps& xfer_props,
+                           DataTransferProps& tuned) {
+    if (xfer_props.getId() == H5P_DEFAULT) {
+        return H5P_DEFAULT;
+    }
+
+    const size_t max_buffer_size = AutoTransferBuffers(xfer_props).getMaxBufferSize();
+    if (max_buffer_size == 0) {
+        return xfer_props.getId();
+    }
+
+    const DataSpace file_space = slice.getSpace();
+    const auto n_elements = static_cast<size_t>(
+        detail::h5s_get_select_npoints(file_space.getId()));
+    const auto file_datatype = slice.getDataType();
+    tuned = details::get_plist<DataTransferProps>(xfer_props, H5Pcopy);
+
+    void* conversion_buffer = nullptr;
+    void* background_buffer = nullptr;
+    const size_t buffer_size =
+        detail::h5p_get_buffer(tuned.getId(), &conversion_buffer, &background_buffer);
+    if (conversion_buffer == nullptr &&
+        detail::h5t_equal(mem_type_id, file_datatype.getId()) <= 0) {
+        const size_t element_size =
+            std::max(static_cast<size_t>(detail::h5t_get_size(mem_type_id)),
+                     file_datatype.getSize());
+        const size_t needed = std::min(n_elements * element_size, max_buffer_size);
+        if (needed > buffer_size) {
+            detail::h5p_set_buffer(tuned.getId(), needed, nullptr, nullptr);
+        }
+    }
+
+    if (detail::h5s_get_select_type(file_space.getId()) == H5S_SEL_HYPERSLABS) {
+        size_t vector_size = 0;
+        detail::h5p_get_hyper_vector_size(tuned.getId(), &vector_size);
+
+        // Every vector holds an offset and a length, for memory and the file.
+        const size_t max_vector_size = max_buffer_size / (2 * (sizeof(hsize_t) + sizeof(size_t)));
+        const auto n_blocks = static_cast<size_t>(
+            detail::h5s_get_select_hyper_nblocks(file_space.getId()));
+        const size_t needed = std::min(n_blocks, max_vector_size);
+        if (needed > vector_size) {
+            detail::h5p_set_hyper_vector_size(tuned.getId(), needed);
+        }
+    }
+
+    return tuned.getId();
+}
+}  // namespace detail
+
+namespace details {
+// Reads which can bypass HDF5's conversion path, installed by
+// `register_fast_conversions`. Returns `false` if the read isn't handled.
+using direct_read_t = bool (*)(hid_t dset_id,
+                               hid_t file_type_id,
+                               hid_t mem_type_id,
+                               hid_t mem_space_id,
+                               hid_t file_space_id,
+                               hid_t xfer_plist_id,
+                               void* buf);
+
+inline std::atomic<direct_read_t>& direct_read_hook() {
+    static std::atomic<direct_read_t> hook{nullptr};
+    return hook;
+}
+
+// Reads the selection of `slice` into `array`. Only if the datatype of the
+// dataset, `file_datatype`, is known, the read may be done by the direct read
+// hook.
+template <class Derivate, class T>
+inline void read_slice_raw(const Derivate& slice,
+                           T* array,
+                           const DataType& mem_datatype,
+                           const DataType* file_datatype,
+                           const DataTransferProps& xfer_props) {
+    DataTransferProps tuned;
+    const auto dataset_id = get_dataset(slice).getId();
+    const auto mem_space_id = get_memspace_id(slice);
+    const auto file_space_id = get_file_space_id(slice);
+    const auto xfer_id = detail::tune_transfer(slice, mem_datatype.getId(), xfer_props, tuned);
+
+    auto direct_read = file_datatype != nullptr ? direct_read_hook().load() : nullptr;
+    if (direct_read != nullptr && direct_read(dataset_id,
+                                              file_datatype->getId(),
+                                              mem_datatype.getId(),
+                                              mem_space_id,
+                                              file_space_id,
+                                              xfer_id,
+                                              static_cast<void*>(array))) {
+        return;
+    }
+
+    detail::h5d_read(dataset_id,
+                     mem_datatype.getId(),
+                     mem_space_id,
+                     file_space_id,
+                     xfer_id,
+                     static_cast<void*>(array));
+}
+}  // namespace details
+
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const HyperSlab& hyperslab,
                                                const DataSpace& memspace) const {
@@ -225,19 +365,20 @@ inline Selection SliceTraits<Derivate>::select(const HyperSlab& hyperslab,
     const auto& slice = static_cast<const Derivate&>(*this);
     auto filespace = hyperslab.apply(slice.getSpace());
 
-    return detail::make_selection(memspace, filespace, details::get_dataset(slice));
+    return detail::make_selection(memspace, std::move(filespace), details::get_dataset(slice));
 }
 
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const HyperSlab& hyper_slab) const {
     const auto& slice = static_cast<const Derivate&>(*this);
-    auto filespace = slice.getSpace();
-    filespace = hyper_slab.apply(filespace);
+    auto filespace = hyper_slab.apply(slice.getSpace());
 
     auto n_elements = detail::h5s_get_select_npoints(filespace.getId());
     auto memspace = DataSpace(std::array<size_t, 1>{size_t(n_elements)});
 
-    return detail::make_selection(memspace, filespace, details::get_dataset(slice));
+    return detail::make_selection(std::move(memspace),
+                                  std::move(filespace),
+                                  details::get_dataset(slice));
 }
 
 
@@ -278,7 +419,7 @@ template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const ElementSet& elements) const {
     const auto& slice = static_cast<const Derivate&>(*this);
     const hsize_t* data = nullptr;
-    const DataSpace space = slice.getSpace().clone();
+    DataSpace space = slice.getSpace().clone();
     const std::size_t length = elements._ids.size();
     if (length % space.getNumberDimensions() != 0) {
         throw DataSpaceException(
@@ -301,7 +442,9 @@ inline Selection SliceTraits<Derivate>::select(const ElementSet& elements) const
 
     detail::h5s_select_elements(space.getId(), H5S_SELECT_SET, num_elements, data);
 
-    return detail::make_selection(DataSpace(num_elements), space, details::get_dataset(slice));
+    return detail::make_selection(DataSpace(num_elements),
+                                  std::move(space),
+                                  details::get_dataset(slice));
 }
 
 template <typename Derivate>
@@ -323,7 +466,7 @@ template <typename Derivate>
 template <typename T>
 inline void SliceTraits<Derivate>::read(T& array, const DataTransferProps& xfer_props) const {
     const auto& slice = static_cast<const Derivate&>(*this);
-    const DataSpace& mem_space = slice.getMemSpace();
+    const DataSpace& mem_space = details::get_mem_space(slice);
 
     auto file_datatype = slice.getDataType();
 
@@ -342,13 +485,25 @@ inline void SliceTraits<Derivate>::read(T& array, const DataTransferProps& xfer_
     auto dims = mem_space.getDimensions();
 
     auto r = details::data_converter::get_reader<T>(dims, array, file_datatype);
-    read_raw(r.getPointer(), buffer_info.data_type, xfer_props);
+
+    // Variable length elements are allocated from an arena, which releases
+    // them all at once, unless the caller installed a memory manager.
+    const auto& t = buffer_info.data_type;
+    const bool is_variable_length = t.getClass() == DataTypeClass::VarLen || t.isVariableStr();
+    details::VlenArena arena(t.isVariableStr() ? 1 : alignof(std::max_align_t));
+    DataTransferProps arena_props;
+    if (is_variable_length && arena.install(xfer_props, arena_props)) {
+        read_raw(r.getPointer(), t, arena_props);
+        r.unserialize(array);
+        return;
+    }
+
+    details::read_slice_raw(slice, r.getPointer(), t, &file_datatype, xfer_props);
     // re-arrange results
     r.unserialize(array);
 
-    auto t = buffer_info.data_type;
-    auto c = t.getClass();
-    if (c == DataTypeClass::VarLen || t.isVariableStr()) {
+    if (is_variable_length) {
+        HIGHFIVE_TIME_CONVERSION(ReclaimNs);
 #if H5_VERSION_GE(1, 12, 0)
         // This one have been created in 1.12.0
         (void)
@@ -372,14 +527,11 @@ inline void SliceTraits<Derivate>::read_raw(T* array,
     static_assert(!std::is_const<T>::value,
                   "read() requires a non-const structure to read data into");
 
-    const auto& slice = static_cast<const Derivate&>(*this);
-
-    detail::h5d_read(details::get_dataset(slice).getId(),
-                     mem_datatype.getId(),
-                     details::get_memspace_id(slice),
-                     slice.getSpace().getId(),
-                     xfer_props.getId(),
-                     static_cast<void*>(array));
+    details::read_slice_raw(static_cast<const Derivate&>(*this),
+                            array,
+                            mem_datatype,
+                            nullptr,
+                            xfer_props);
 }
 
 
@@ -397,7 +549,7 @@ template <typename Derivate>
 template <typename T>
 inline void SliceTraits<Derivate>::write(const T& buffer, const DataTransferProps& xfer_props) {
     const auto& slice = static_cast<const Derivate&>(*this);
-    const DataSpace& mem_space = slice.getMemSpace();
+    const DataSpace& mem_space = details::get_mem_space(slice);
     auto dims = mem_space.getDimensions();
 
     auto file_datatype = slice.getDataType();
@@ -426,11 +578,12 @@ inline void SliceTraits<Derivate>::write_raw(const T* buffer,
                                              const DataTransferProps& xfer_props) {
     const auto& slice = static_cast<const Derivate&>(*this);
 
+    DataTransferProps tuned;
     detail::h5d_write(details::get_dataset(slice).getId(),
                       mem_datatype.getId(),
                       details::get_memspace_id(slice),
-                      slice.getSpace().getId(),
-                      xfer_props.getId(),
+                      details::get_file_space_id(slice),
+                      detail::tune_transfer(slice, mem_datatype.getId(), xfer_props, tuned),
                       static_cast<const void*>(buffer));
 }
 
@@ -444,6 +597,358 @@ inline void SliceTraits<Derivate>::write_raw(const T* buffer, const DataTransfer
     write_raw(buffer, mem_datatype, xfer_props);
 }
 
+namespace details {
+// The number of bytes `SliceTraits::fill` writes at once.
+constexpr size_t fill_block_bytes = 1024 * 1024;
+
+// The shape of the blocks in which `SliceTraits::fill` writes a selection.
+inline std::vector<hsize_t> compute_fill_block(DataSetCreateProps dcpl,
+                                               const std::vector<size_t>& dims,
+                                               size_t element_size) {
+    const size_t max_elements = std::max(fill_block_bytes / element_size, size_t(1));
+
+    if (detail::h5p_get_layout(dcpl.getId()) == H5D_CHUNKED) {
+        // Whole chunks, merged along the trailing dimensions while the block
+        // fits into the budget. Every block is written with one call.
+        const auto chunk = Chunking(dcpl).getDimensions();
+        std::vector<hsize_t> block = chunk;
+        for (size_t i = block.size(); i-- > 0;) {
+            auto inner = std::accumulate(block.begin(), block.end(), hsize_t(1),
+                                         std::multiplies<hsize_t>()) /
+                         block[i];
+            auto n_chunks = (hsize_t(dims[i]) + chunk[i] - 1) / chunk[i];
+            auto n_fit = hsize_t(max_elements) / (inner * chunk[i]);
+            block[i] = chunk[i] * std::max(hsize_t(1), std::min(n_chunks, n_fit));
+            if (block[i] < n_chunks * chunk[i]) {
+                break;
+            }
+        }
+        return block;
+    }
+
+    // Shrink the leading dimensions until the block fits into the budget.
+    std::vector<hsize_t> block(dims.begin(), dims.end());
+    for (size_t i = 0; i < block.size(); ++i) {
+        auto inner = std::accumulate(block.begin() + static_cast<std::ptrdiff_t>(i) + 1,
+                                     block.end(),
+                                     hsize_t(1),
+                                     std::multiplies<hsize_t>());
+        block[i] = std::max(hsize_t(1), std::min(block[i], hsize_t(max_elements) / inner));
+        if (block[i] * inner <= max_elements) {
+            break;
+        }
+    }
+
+    return block;
+}
+}  // namespace details
+
+template <typename Derivate>
+template <typename T>
+inline void SliceTraits<Derivate>::fill(const T& value, const DataTransferProps& xfer_props) {
+    static_assert(details::inspector<T>::ndim == 0,
+                  "fill() requires a single element, e.g. a `double`.");
+
+    const auto& slice = static_cast<const Derivate&>(*this);
+    const auto& dataset = details::get_dataset(slice);
+    const DataSpace file_space = slice.getSpace();
+
+    auto n_points = static_cast<size_t>(detail::h5s_get_select_npoints(file_space.getId()));
+    if (n_points == 0) {
+        return;
+    }
+
+    auto file_datatype = slice.getDataType();
+    const details::BufferInfo<T> buffer_info(
+        file_datatype,
+        [&dataset]() -> std::string { return dataset.getPath(); },
+        details::BufferInfo<T>::Operation::write);
+    const auto& mem_datatype = buffer_info.data_type;
+    auto w = details::data_converter::serialize<T>(value, std::vector<size_t>{}, file_datatype);
+
+    const auto dims = file_space.getDimensions();
+    const auto block = details::compute_fill_block(dataset.getCreatePropertyList(),
+                                                   dims,
+                                                   mem_datatype.getSize());
+    const auto select_type = detail::h5s_get_select_type(file_space.getId());
+
+    // Point selections can't be intersected with a hyperslab, hence they're
+    // written in one go.
+    auto n_block = std::accumulate(block.begin(), block.end(), size_t(1), std::multiplies<>());
+    auto n_buffer = select_type == H5S_SEL_POINTS ? n_points : std::min(n_points, n_block);
+
+    std::vector<char> buffer(n_buffer * mem_datatype.getSize());
+    auto buffer_space = DataSpace(std::vector<size_t>{n_buffer});
+    detail::h5d_fill(w.getPointer(),
+                     mem_datatype.getId(),
+                     buffer.data(),
+                     mem_datatype.getId(),
+                     buffer_space.getId());
+
+    if (n_points == n_buffer) {
+        detail::h5d_write(dataset.getId(),
+                          mem_datatype.getId(),
+                          buffer_space.getId(),
+                          file_space.getId(),
+                          xfer_props.getId(),
+                          buffer.data());
+        return;
+    }
+
+    const size_t rank = dims.size();
+    std::vector<hsize_t> start(rank);
+    std::vector<hsize_t> end(rank);
+    detail::h5s_get_select_bounds(file_space.getId(), start.data(), end.data());
+
+    // Visit every block intersecting the bounding box of the selection.
+    std::vector<hsize_t> first(rank);
+    std::vector<hsize_t> last(rank);
+    for (size_t i = 0; i < rank; ++i) {
+        first[i] = start[i] / block[i];
+        last[i] = end[i] / block[i];
+    }
+
+    auto op = select_type == H5S_SEL_ALL ? H5S_SELECT_SET : H5S_SELECT_AND;
+    std::vector<hsize_t> index = first;
+    std::vector<hsize_t> offset(rank);
+    std::vector<hsize_t> count(rank);
+    bool done = false;
+    while (!done) {
+        for (size_t i = 0; i < rank; ++i) {
+            offset[i] = index[i] * block[i];
+            count[i] = std::min(block[i], hsize_t(dims[i]) - offset[i]);
+        }
+
+        auto block_space = file_space.clone();
+        detail::h5s_select_hyperslab(
+            block_space.getId(), op, offset.data(), nullptr, count.data(), nullptr);
+
+        auto n_selected = detail::h5s_get_select_npoints(block_space.getId());
+        if (n_selected != 0) {
+            auto mem_space = DataSpace(std::vector<size_t>{static_cast<size_t>(n_selected)});
+            detail::h5d_write(dataset.getId(),
+                              mem_datatype.getId(),
+                              mem_space.getId(),
+                              block_space.getId(),
+                              xfer_props.getId(),
+                              buffer.data());
+        }
+
+        done = true;
+        for (size_t axis = rank; axis-- > 0;) {
+            if (++index[axis] <= last[axis]) {
+                done = false;
+                break;
+            }
+            index[axis] = first[axis];
+        }
+    }
+}
+
+namespace detail {
+inline SelectionType get_selection_type(hid_t space_id) {
+    switch (detail::h5s_get_select_type(space_id)) {
+    case H5S_SEL_POINTS:
+        return SelectionType::Points;
+    case H5S_SEL_HYPERSLABS:
+        return SelectionType::Hyperslabs;
+    case H5S_SEL_ALL:
+        return SelectionType::All;
+    default:
+        return SelectionType::None;
+    }
+}
+
+// Whether the selection in `space_id` intersects the block from `start` to
+// `end`, inclusive.
+inline bool selection_intersects_block(hid_t space_id,
+                                       const std::vector<hsize_t>& start,
+                                       const std::vector<hsize_t>& end) {
+#if H5_VERSION_GE(1, 10, 7)
+    return detail::h5s_select_intersect_block(space_id, start.data(), end.data()) > 0;
+#else
+    // Older versions can only compare the bounding box of the selection.
+    std::vector<hsize_t> lower(start.size());
+    std::vector<hsize_t> upper(start.size());
+    detail::h5s_get_select_bounds(space_id, lower.data(), upper.data());
+    for (size_t i = 0; i < start.size(); ++i) {
+        if (end[i] < lower[i] || upper[i] < start[i]) {
+            return false;
+        }
+    }
+    return true;
+#endif
+}
+
+// The copy made by `data_converter` for a `T` and the size of its buffer.
+template <class T, class Enable = void>
+struct converter_copy;
+
+template <class T>
+struct converter_copy<T, typename details::enable_shallow_copy<T>::type> {
+    static constexpr CopyMode mode = CopyMode::Shallow;
+
+    static size_t bytes(const DataType&, size_t) {
+        return 0;
+    }
+};
+
+template <class T>
+struct converter_copy<T, typename details::enable_deep_copy<T>::type> {
+    static constexpr CopyMode mode = CopyMode::Deep;
+
+    static size_t bytes(const DataType&, size_t n_elements) {
+        return n_elements * sizeof(typename details::inspector<T>::hdf5_type);
+    }
+};
+
+template <class T>
+struct converter_copy<T, typename details::enable_string_copy<T>::type> {
+    static constexpr CopyMode mode = CopyMode::String;
+
+    static size_t bytes(const DataType& mem_datatype, size_t n_elements) {
+        return n_elements *
+               (mem_datatype.isVariableStr() ? sizeof(char*) : mem_datatype.getSize());
+    }
+};
+}  // namespace detail
+
+template <typename Derivate>
+template <typename T>
+inline TransferReport SliceTraits<Derivate>::explain(TransferDirection direction,
+                                                     const DataTransferProps& xfer_props) const {
+    const auto& slice = static_cast<const Derivate&>(*this);
+    const auto& dataset = details::get_dataset(slice);
+    const DataSpace file_space = slice.getSpace();
+    const hid_t space_id = file_space.getId();
+
+    TransferReport report;
+    report.selection_type = detail::get_selection_type(space_id);
+    report.n_elements = static_cast<size_t>(detail::h5s_get_select_npoints(space_id));
+    if (report.selection_type == SelectionType::Hyperslabs) {
+        report.n_blocks = static_cast<size_t>(detail::h5s_get_select_hyper_nblocks(space_id));
+    } else if (report.selection_type == SelectionType::Points) {
+        report.n_blocks = report.n_elements;
+    } else if (report.selection_type == SelectionType::All) {
+        report.n_blocks = 1;
+    }
+
+    auto dcpl = dataset.getCreatePropertyList();
+    report.is_chunked = detail::h5p_get_layout(dcpl.getId()) == H5D_CHUNKED;
+#if H5_VERSION_GE(1, 10, 5)
+    if (report.is_chunked && report.n_elements != 0) {
+        const size_t n_allocated_chunks = dataset.getNumberAllocatedChunks();
+        const auto chunk_dims = Chunking(dcpl).getDimensions();
+        const size_t rank = chunk_dims.size();
+
+        // The chunks which overlap the bounding box of the selection. Their
+        // number saturates above what's looked up.
+        std::vector<hsize_t> first(rank);
+        std::vector<hsize_t> last(rank);
+        detail::h5s_get_select_bounds(space_id, first.data(), last.data());
+        const size_t too_many = details::max_probed_chunks + 1;
+        size_t n_box_chunks = 1;
+        for (size_t i = 0; i < rank; ++i) {
+            first[i] /= chunk_dims[i];
+            last[i] /= chunk_dims[i];
+            auto extent = static_cast<size_t>(last[i] - first[i] + 1);
+            n_box_chunks = extent > too_many / n_box_chunks ? too_many : n_box_chunks * extent;
+        }
+
+        // Either every allocated chunk is listed, or every chunk in the box is
+        // looked up by its coordinates, whichever is cheaper.
+        const bool can_list = details::can_list_chunks(n_allocated_chunks);
+        const bool can_probe = n_box_chunks <= details::max_probed_chunks;
+        if (can_list && (n_allocated_chunks <= n_box_chunks || !can_probe)) {
+            std::vector<hsize_t> start(rank);
+            std::vector<hsize_t> end(rank);
+            for (const auto& chunk: dataset.listAllocatedChunks()) {
+                for (size_t i = 0; i < rank; ++i) {
+                    start[i] = chunk.offset[i];
+                    end[i] = chunk.offset[i] + chunk_dims[i] - 1;
+                }
+
+                if (detail::selection_intersects_block(space_id, start, end)) {
+                    report.n_chunks += 1;
+                    report.chunk_bytes += chunk.size;
+                }
+            }
+        } else if (can_probe) {
+            std::vector<hsize_t> index = first;
+            std::vector<hsize_t> start(rank);
+            std::vector<hsize_t> end(rank);
+            for (size_t k = 0; k < n_box_chunks; ++k) {
+                for (size_t i = 0; i < rank; ++i) {
+                    start[i] = index[i] * chunk_dims[i];
+                    end[i] = start[i] + chunk_dims[i] - 1;
+                }
+
+                if (detail::selection_intersects_block(space_id, start, end)) {
+                    unsigned filter_mask = 0;
+                    haddr_t addr = HADDR_UNDEF;
+                    hsize_t size = 0;
+                    detail::h5d_get_chunk_info_by_coord(
+                        dataset.getId(), start.data(), &filter_mask, &addr, &size);
+                    if (addr != HADDR_UNDEF) {
+                        report.n_chunks += 1;
+                        report.chunk_bytes += static_cast<uint64_t>(size);
+                    }
+                }
+
+                for (size_t axis = rank; axis-- > 0;) {
+                    if (++index[axis] <= last[axis]) {
+                        break;
+                    }
+                    index[axis] = first[axis];
+                }
+            }
+        } else {
+            report.n_chunks = n_allocated_chunks;
+            report.chunk_bytes = dataset.getStorageSize();
+            report.is_chunk_count_exact = false;
+        }
+    }
+#endif
+
+    auto file_datatype = slice.getDataType();
+    const details::BufferInfo<T> buffer_info(
+        file_datatype,
+        [&dataset]() -> std::string { return dataset.getPath(); },
+        direction == TransferDirection::Read ? details::BufferInfo<T>::Operation::read
+                                             : details::BufferInfo<T>::Operation::write);
+    const auto& mem_datatype = buffer_info.data_type;
+
+    DataTransferProps tuned;
+    hid_t dxpl_id = detail::tune_transfer(slice, mem_datatype.getId(), xfer_props, tuned);
+    if (dxpl_id == H5P_DEFAULT) {
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    }
+    if (report.selection_type == SelectionType::Hyperslabs) {
+        detail::h5p_get_hyper_vector_size(dxpl_id, &report.hyper_vector_size);
+    }
+
+    if (detail::h5t_equal(file_datatype.getId(), mem_datatype.getId()) <= 0) {
+        const bool is_read = direction == TransferDirection::Read;
+        const hid_t src_id = is_read ? file_datatype.getId() : mem_datatype.getId();
+        const hid_t dst_id = is_read ? mem_datatype.getId() : file_datatype.getId();
+
+        H5T_cdata_t* cdata = nullptr;
+        detail::h5t_find(src_id, dst_id, &cdata);
+        report.conversion = detail::h5t_compiler_conv(src_id, dst_id) > 0 ? ConversionPath::Hard
+                                                                           : ConversionPath::Soft;
+
+        const size_t element_size = std::max(file_datatype.getSize(), mem_datatype.getSize());
+        report.conversion_bytes = std::min(detail::h5p_get_buffer(dxpl_id, nullptr, nullptr),
+                                           report.n_elements * element_size);
+    }
+
+    using converter_copy = detail::converter_copy<typename std::remove_const<T>::type>;
+    report.copy_mode = converter_copy::mode;
+    report.converter_bytes = converter_copy::bytes(mem_datatype, report.n_elements);
+
+    return report;
+}
+
 namespace detail {
 inline const DataSet& getDataSet(const Selection& selection) {
     return selection.getDataset();
@@ -457,8 +962,8 @@ inline const DataSet& getDataSet(const DataSet& dataset) {
 
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::squeezeMemSpace(const std::vector<size_t>& axes) const {
-    auto slice = static_cast<const Derivate&>(*this);
-    auto mem_dims = slice.getMemSpace().getDimensions();
+    const auto& slice = static_cast<const Derivate&>(*this);
+    auto mem_dims = details::get_mem_space(slice).getDimensions();
     auto squeezed_dims = detail::squeeze(mem_dims, axes);
 
     return detail::make_selection(DataSpace(squeezed_dims),
@@ -468,9 +973,9 @@ inline Selection SliceTraits<Derivate>::squeezeMemSpace(const std::vector<size_t
 
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::reshapeMemSpace(const std::vector<size_t>& new_dims) const {
-    auto slice = static_cast<const Derivate&>(*this);
+    const auto& slice = static_cast<const Derivate&>(*this);
 
-    detail::assert_compatible_spaces(slice.getMemSpace(), new_dims);
+    detail::assert_compatible_spaces(details::get_mem_space(slice), new_dims);
     return detail::make_selection(DataSpace(new_dims), slice.getSpace(), detail::getDataSet(slice));
 }
 
@@ -0,0 +1,225 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <set>
+
+#include "../H5StorageAudit.hpp"
+#include "h5f_wrapper.hpp"
+#include "h5p_wrapper.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+inline const char* storage_audit_layout_name(H5D_layout_t layout) {
+    switch (layout) {
+    case H5D_COMPACT:
+        return "compact";
+    case H5D_CONTIGUOUS:
+        return "contiguous";
+    case H5D_CHUNKED:
+        return "chunked";
+#if H5_VERSION_GE(1, 10, 0)
+    case H5D_VIRTUAL:
+        return "virtual";
+#endif
+    default:
+        return "unknown";
+    }
+}
+
+inline void storage_audit_write_string(std::ostream& os, const std::string& value) {
+    os << '"';
+    for (char c: value) {
+        os << c;
+        if (c == '"') {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+template <class T>
+inline void storage_audit_write_list(std::ostream& os, const std::vector<T>& values, char sep) {
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i != 0) {
+            os << sep;
+        }
+        os << values[i];
+    }
+}
+
+}  // namespace details
+
+inline StorageAudit::StorageAudit(const File& file)
+    : _file_name(file.getName())
+    , _file_size(file.getFileSize())
+    , _free_space(file.getFreeSpace()) {
+#if H5_VERSION_GE(1, 10, 0)
+    H5F_info2_t info;
+    detail::h5f_get_info2(file.getId(), &info);
+    _superblock_size = static_cast<uint64_t>(info.super.super_size + info.super.super_ext_size);
+    _free_space_metadata_size = static_cast<uint64_t>(info.free.meta_size);
+#endif
+
+    std::set<haddr_t> visited;
+    std::vector<std::string> paths;
+    file.visit([&visited, &paths](const NodeInfo& node) {
+        if (node.object_type == ObjectType::Dataset && visited.insert(node.address).second) {
+            paths.push_back("/" + node.path);
+        }
+    });
+
+    _datasets.reserve(paths.size());
+    for (const auto& path: paths) {
+        _datasets.push_back(audit(file.getDataSet(path), path));
+    }
+}
+
+inline DataSetStorageInfo StorageAudit::audit(const DataSet& dataset, const std::string& path) {
+    DataSetStorageInfo info;
+    info.path = path;
+    info.dimensions = dataset.getDimensions();
+    info.logical_bytes = static_cast<uint64_t>(compute_total_size(info.dimensions) *
+                                               dataset.getDataType().getSize());
+    info.storage_bytes = dataset.getStorageSize();
+
+    auto dcpl = dataset.getCreatePropertyList();
+    info.layout = detail::h5p_get_layout(dcpl.getId());
+
+    int n_filters = detail::h5p_get_nfilters(dcpl.getId());
+    for (int i = 0; i < n_filters; ++i) {
+        char name[256] = {};
+        size_t n_values = 0;
+        unsigned flags = 0;
+        unsigned filter_config = 0;
+        auto filter = detail::h5p_get_filter2(dcpl.getId(),
+                                              static_cast<unsigned>(i),
+                                              &flags,
+                                              &n_values,
+                                              nullptr,
+                                              sizeof(name),
+                                              name,
+                                              &filter_config);
+        info.filters.emplace_back(name[0] != '\0' ? std::string(name)
+                                                  : "filter " + std::to_string(filter));
+    }
+
+    if (info.layout != H5D_CHUNKED) {
+        return info;
+    }
+
+    info.chunk_dimensions = Chunking(dcpl).getDimensions();
+    info.n_possible_chunks = 1;
+    for (size_t i = 0; i < info.dimensions.size(); ++i) {
+        auto chunk = static_cast<size_t>(info.chunk_dimensions[i]);
+        info.n_possible_chunks *= (info.dimensions[i] + chunk - 1) / chunk;
+    }
+
+#if H5_VERSION_GE(1, 10, 5)
+    info.n_allocated_chunks = dataset.getNumberAllocatedChunks();
+    if (!details::can_list_chunks(info.n_allocated_chunks)) {
+        info.mean_chunk_bytes = double(info.storage_bytes) / double(info.n_allocated_chunks);
+        return info;
+    }
+
+    auto chunks = dataset.listAllocatedChunks();
+    if (!chunks.empty()) {
+        uint64_t total = 0;
+        info.min_chunk_bytes = std::numeric_limits<uint64_t>::max();
+        for (const auto& chunk: chunks) {
+            info.min_chunk_bytes = std::min(info.min_chunk_bytes, chunk.size);
+            info.max_chunk_bytes = std::max(info.max_chunk_bytes, chunk.size);
+            total += chunk.size;
+        }
+        info.mean_chunk_bytes = double(total) / double(chunks.size());
+    }
+#endif
+
+    return info;
+}
+
+inline const std::vector<DataSetStorageInfo>& StorageAudit::getDataSets() const noexcept {
+    return _datasets;
+}
+
+inline const std::string& StorageAudit::getFileName() const noexcept {
+    return _file_name;
+}
+
+inline uint64_t StorageAudit::getFileSize() const noexcept {
+    return _file_size;
+}
+
+inline uint64_t StorageAudit::getFreeSpace() const noexcept {
+    return _free_space;
+}
+
+inline uint64_t StorageAudit::getSuperblockSize() const noexcept {
+    return _superblock_size;
+}
+
+inline uint64_t StorageAudit::getFreeSpaceMetadataSize() const noexcept {
+    return _free_space_metadata_size;
+}
+
+inline uint64_t StorageAudit::getLogicalBytes() const noexcept {
+    uint64_t total = 0;
+    for (const auto& dataset: _datasets) {
+        total += dataset.logical_bytes;
+    }
+    return total;
+}
+
+inline uint64_t StorageAudit::getStorageBytes() const noexcept {
+    uint64_t total = 0;
+    for (const auto& dataset: _datasets) {
+        total += dataset.storage_bytes;
+    }
+    return total;
+}
+
+inline void StorageAudit::write(std::ostream& os, bool header) const {
+    if (header) {
+        os << "file,path,layout,dimensions,logical_bytes,storage_bytes,compression_ratio,"
+              "chunk_dimensions,allocated_chunks,possible_chunks,min_chunk_bytes,"
+              "mean_chunk_bytes,max_chunk_bytes,filters\n";
+    }
+
+    for (const auto& dataset: _datasets) {
+        details::storage_audit_write_string(os, _file_name);
+        os << ',';
+        details::storage_audit_write_string(os, dataset.path);
+        os << ',' << details::storage_audit_layout_name(dataset.layout) << ',';
+        details::storage_audit_write_list(os, dataset.dimensions, 'x');
+        os << ',' << dataset.logical_bytes << ',' << dataset.storage_bytes << ','
+           << dataset.getCompressionRatio() << ',';
+        details::storage_audit_write_list(os, dataset.chunk_dimensions, 'x');
+        os << ',' << dataset.n_allocated_chunks << ',' << dataset.n_possible_chunks << ','
+           << dataset.min_chunk_bytes << ',' << dataset.mean_chunk_bytes << ','
+           << dataset.max_chunk_bytes << ',';
+
+        std::string filters;
+        for (const auto& filter: dataset.filters) {
+            filters += (filters.empty() ? "" : ";") + filter;
+        }
+        details::storage_audit_write_string(os, filters);
+        os << '\n';
+    }
+
+    if (!os) {
+        throw FileException("Unable to write the storage audit.");
+    }
+}
+
+}  // namespace HighFive
@@ -0,0 +1,237 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include "../H5StringColumn.hpp"
+#include "h5p_wrapper.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+constexpr char string_column_marker[] = "highfive_string_column";
+constexpr uint32_t string_column_version = 1;
+constexpr size_t string_column_chunk_bytes = 256 * 1024;
+
+// The chunk size of the bytes: the one of `create_props`, if it's chunked.
+inline size_t string_column_chunk_size(const DataSetCreateProps& create_props) {
+    if (create_props.getId() == H5P_DEFAULT ||
+        detail::h5p_get_layout(create_props.getId()) != H5D_CHUNKED) {
+        return string_column_chunk_bytes;
+    }
+
+    auto props = get_plist<DataSetCreateProps>(create_props, H5Pcopy);
+    const auto chunk_dims = Chunking(props).getDimensions();
+    if (chunk_dims.size() != 1) {
+        throw DataSetException("The chunks of a string column must be one-dimensional.");
+    }
+    return static_cast<size_t>(chunk_dims[0]);
+}
+
+// A copy of `create_props` with chunks of `chunk_size` elements.
+inline DataSetCreateProps string_column_create_props(const DataSetCreateProps& create_props,
+                                                     size_t chunk_size) {
+    DataSetCreateProps props;
+    if (create_props.getId() != H5P_DEFAULT) {
+        props = get_plist<DataSetCreateProps>(create_props, H5Pcopy);
+    }
+    props.add(Chunking(chunk_size));
+    return props;
+}
+
+}  // namespace details
+
+template <class Node>
+inline StringColumn StringColumn::create(Node& node,
+                                         const std::string& name,
+                                         const std::vector<std::string>& strings,
+                                         const DataSetCreateProps& create_props) {
+    // Both datasets have chunks of the same size in bytes.
+    const size_t chunk_bytes = details::string_column_chunk_size(create_props);
+    auto bytes_props = details::string_column_create_props(create_props, chunk_bytes);
+    auto offsets_props = details::string_column_create_props(create_props,
+                                                             std::max<size_t>(chunk_bytes / 8, 1));
+
+    auto group = node.createGroup(name);
+    group.createAttribute(details::string_column_marker, details::string_column_version);
+    group.template createDataSet<uint8_t>("bytes",
+                                          DataSpace({0}, {DataSpace::UNLIMITED}),
+                                          bytes_props);
+    group
+        .template createDataSet<uint64_t>("offsets",
+                                          DataSpace({1}, {DataSpace::UNLIMITED}),
+                                          offsets_props)
+        .write(std::vector<uint64_t>{0});
+
+    StringColumn column(group);
+    column.append(strings);
+    return column;
+}
+
+template <class Node>
+inline StringColumn StringColumn::open(const Node& node, const std::string& name) {
+    if (!isStringColumn(node, name)) {
+        throw GroupException("'" + name + "' is not a string column.");
+    }
+    return StringColumn(node.getGroup(name));
+}
+
+template <class Node>
+inline bool StringColumn::isStringColumn(const Node& node, const std::string& name) {
+    if (!node.exist(name) || node.getObjectType(name) != ObjectType::Group) {
+        return false;
+    }
+
+    auto group = node.getGroup(name);
+    return group.hasAttribute(details::string_column_marker) &&
+           group.getAttribute(details::string_column_marker).template read<uint32_t>() ==
+               details::string_column_version;
+}
+
+inline StringColumn::StringColumn(const Group& group)
+    : _group(group)
+    , _bytes(group.getDataSet("bytes"))
+    , _offsets(group.getDataSet("offsets")) {}
+
+inline size_t StringColumn::size() const {
+    return _offsets.getElementCount() - 1;
+}
+
+inline size_t StringColumn::getByteSize() const {
+    return _bytes.getElementCount();
+}
+
+inline void StringColumn::append(const std::vector<std::string>& strings,
+                                 const DataTransferProps& xfer_props) {
+    if (strings.empty()) {
+        return;
+    }
+
+    const size_t n_strings = size();
+    const size_t n_bytes = getByteSize();
+
+    std::vector<uint64_t> offsets(strings.size());
+    size_t end = n_bytes;
+    for (size_t i = 0; i < strings.size(); ++i) {
+        end += strings[i].size();
+        offsets[i] = end;
+    }
+
+    std::vector<char> bytes(end - n_bytes);
+    auto it = bytes.begin();
+    for (const auto& s: strings) {
+        it = std::copy(s.begin(), s.end(), it);
+    }
+
+    // The bytes are written first, such that the offsets never point past them.
+    if (!bytes.empty()) {
+        _bytes.resize({end});
+        _bytes.select({n_bytes}, {bytes.size()})
+            .write_raw(bytes.data(), AtomicType<uint8_t>(), xfer_props);
+    }
+    _offsets.resize({n_strings + strings.size() + 1});
+    _offsets.select({n_strings + 1}, {offsets.size()}).write_raw(offsets.data(), xfer_props);
+}
+
+inline uint64_t StringColumn::readOffsets(size_t offset,
+                                         size_t count,
+                                         const DataTransferProps& xfer_props,
+                                         std::vector<uint64_t>& offsets) const {
+    if (offset + count > size()) {
+        throw DataSpaceException("Strings [" + std::to_string(offset) + ", " +
+                                 std::to_string(offset + count) +
+                                 ") are out of range of a string column of size " +
+                                 std::to_string(size()) + ".");
+    }
+
+    offsets.resize(count + 1);
+    _offsets.select({offset}, {count + 1}).read_raw(offsets.data(), xfer_props);
+
+    // The offsets come from the file, they're used to index the bytes.
+    if (!std::is_sorted(offsets.begin(), offsets.end())) {
+        throw DataSetException("The offsets of the string column '" + _group.getPath() +
+                               "' aren't increasing.");
+    }
+    if (offsets.back() > getByteSize()) {
+        throw DataSetException("The offsets of the string column '" + _group.getPath() +
+                               "' point past its " + std::to_string(getByteSize()) +
+                               " bytes.");
+    }
+
+    const uint64_t begin = offsets.front();
+    for (auto& o: offsets) {
+        o -= begin;
+    }
+    return begin;
+}
+
+inline void StringColumn::readBytes(uint64_t begin,
+                                    size_t n_bytes,
+                                    char* bytes,
+                                    const DataTransferProps& xfer_props) const {
+    if (n_bytes != 0) {
+        _bytes.select({static_cast<size_t>(begin)}, {n_bytes})
+            .read_raw(bytes, AtomicType<uint8_t>(), xfer_props);
+    }
+}
+
+inline std::vector<std::string> StringColumn::read(const DataTransferProps& xfer_props) const {
+    return read(0, size(), xfer_props);
+}
+
+inline std::vector<std::string> StringColumn::read(size_t offset,
+                                                   size_t count,
+                                                   const DataTransferProps& xfer_props) const {
+    std::vector<uint64_t> offsets;
+    const uint64_t begin = readOffsets(offset, count, xfer_props, offsets);
+    std::vector<char> bytes(static_cast<size_t>(offsets.back()));
+    readBytes(begin, bytes.size(), bytes.data(), xfer_props);
+
+    std::vector<std::string> strings;
+    strings.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        strings.emplace_back(bytes.data() + offsets[i],
+                             static_cast<size_t>(offsets[i + 1] - offsets[i]));
+    }
+    return strings;
+}
+
+inline StringTable StringColumn::readTable(const DataTransferProps& xfer_props) const {
+    return readTable(0, size(), xfer_props);
+}
+
+inline StringTable StringColumn::readTable(size_t offset,
+                                           size_t count,
+                                           const DataTransferProps& xfer_props) const {
+    std::vector<uint64_t> offsets;
+    const uint64_t begin = readOffsets(offset, count, xfer_props, offsets);
+    const auto n_bytes = static_cast<size_t>(offsets.back());
+
+    // The bytes are read into the front of the arena. Then, starting from the
+    // last string, every string is moved to its place, which leaves room for
+    // the `\0` in front of it.
+    StringTable table;
+    table._arena.resize(n_bytes + count);
+    table._offsets.resize(count + 1);
+    char* arena = table._arena.data();
+    readBytes(begin, n_bytes, arena, xfer_props);
+    for (size_t i = count; i-- > 0;) {
+        const auto start = static_cast<size_t>(offsets[i]);
+        const auto length = static_cast<size_t>(offsets[i + 1]) - start;
+        std::memmove(arena + start + i, arena + start, length);
+        arena[start + i + length] = '\0';
+        table._offsets[i + 1] = start + i + length + 1;
+    }
+    return table;
+}
+
+}  // namespace HighFive
@@ -0,0 +1,86 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <cstring>
+
+#include "../H5StringTable.hpp"
+#include "H5Converter_misc.hpp"
+
+namespace HighFive {
+
+inline StringTable::StringTable(const std::vector<std::string>& strings) {
+    size_t n_bytes = 0;
+    for (const auto& s: strings) {
+        n_bytes += s.size();
+    }
+    reserve(strings.size(), n_bytes);
+    for (const auto& s: strings) {
+        push_back(s);
+    }
+}
+
+inline void StringTable::reserve(size_t n_strings, size_t n_bytes) {
+    _arena.reserve(n_bytes + n_strings);
+    _offsets.reserve(n_strings + 1);
+}
+
+inline void StringTable::push_back(const char* data, size_t length) {
+    _arena.insert(_arena.end(), data, data + length);
+    _arena.push_back('\0');
+    _offsets.push_back(_arena.size());
+}
+
+inline void StringTable::clear() noexcept {
+    _arena.clear();
+    _offsets.resize(1);
+}
+
+inline std::vector<std::string> StringTable::toVector() const {
+    std::vector<std::string> strings;
+    strings.reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+        strings.emplace_back(data(i), length(i));
+    }
+    return strings;
+}
+
+namespace details {
+
+template <class It>
+inline void inspector<StringTable>::unserialize(const It& vec,
+                                                const std::vector<size_t>& dims,
+                                                type& val) {
+    const size_t n_strings = dims[0];
+    auto& offsets = val._offsets;
+
+    // Compute all lengths first, such that the arena is allocated once.
+    offsets.resize(n_strings + 1);
+    for (size_t i = 0; i < n_strings; ++i) {
+        const It it = vec + i;
+        const auto view = *it;
+        size_t length = view.length();
+        if (view.getPadding() == StringPadding::NullPadded) {
+            length = trimmed_length(view.data(), length, '\0');
+        } else if (view.getPadding() == StringPadding::SpacePadded) {
+            length = trimmed_length(view.data(), length, ' ');
+        }
+        offsets[i + 1] = offsets[i] + length + 1;
+    }
+
+    // The arena is zero-initialized, i.e. the strings are null-terminated.
+    val._arena.resize(offsets[n_strings]);
+    for (size_t i = 0; i < n_strings; ++i) {
+        const It it = vec + i;
+        std::memcpy(val._arena.data() + offsets[i], (*it).data(), val.length(i));
+    }
+}
+
+}  // namespace details
+}  // namespace HighFive
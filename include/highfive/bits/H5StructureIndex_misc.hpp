@@ -0,0 +1,441 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <type_traits>
+
+#if HIGHFIVE_CXX_STD >= 17
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+#endif
+
+#include "../H5StructureIndex.hpp"
+#include "h5a_wrapper.hpp"
+#include "h5f_wrapper.hpp"
+#include "h5g_wrapper.hpp"
+#include "h5o_wrapper.hpp"
+#include "h5t_wrapper.hpp"
+#include "H5Iterables_misc.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// The format is only meant to be read back on the same platform, hence
+// integers are stored in native byte order. The marker detects mismatches.
+// The data is followed by its checksum.
+constexpr char structure_index_magic[8] = {'H', '5', 'S', 'I', 'D', 'X', '0', '3'};
+constexpr uint32_t structure_index_byte_order = 0x01020304u;
+
+// FNV-1a, good enough to detect truncated or corrupt files.
+inline uint64_t structure_index_checksum(const char* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325u;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(data[i])) * 0x100000001b3u;
+    }
+    return hash;
+}
+
+template <class T>
+inline void structure_index_write(std::ostream& os, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types.");
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+inline void structure_index_write(std::ostream& os, const std::string& value) {
+    structure_index_write(os, static_cast<uint64_t>(value.size()));
+    os.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+template <class T>
+inline T structure_index_read(std::istream& is) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types.");
+    T value;
+    if (!is.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+        throw FileException("Unable to read the structure index: unexpected end of data.");
+    }
+    return value;
+}
+
+// Reads the number of elements of `element_size` bytes which follow, and
+// checks that they fit into the remaining `n_bytes` of the index.
+inline size_t structure_index_read_length(std::istream& is, size_t element_size, size_t n_bytes) {
+    auto length = structure_index_read<uint64_t>(is);
+    auto position = static_cast<size_t>(is.tellg());
+    if (length > (n_bytes - std::min(position, n_bytes)) / element_size) {
+        throw FileException("Unable to read the structure index: invalid length.");
+    }
+    return static_cast<size_t>(length);
+}
+
+inline std::string structure_index_read_string(std::istream& is, size_t n_bytes) {
+    std::string value(structure_index_read_length(is, 1, n_bytes), '\0');
+    if (!is.read(&value[0], static_cast<std::streamsize>(value.size()))) {
+        throw FileException("Unable to read the structure index: unexpected end of data.");
+    }
+    return value;
+}
+
+}  // namespace details
+
+inline StructureIndex::StructureIndex(const File& file)
+    : _file_identity(FileIdentity::read(file)) {
+    Entry root;
+    root.object_type = ObjectType::Group;
+    details::HighFiveIterateData iterate_data(root.attribute_names);
+    detail::h5a_iterate_by_name(file.getId(),
+                                ".",
+                                H5_INDEX_NAME,
+                                H5_ITER_INC,
+                                nullptr,
+                                &details::internal_high_five_iterate<H5A_info_t>,
+                                static_cast<void*>(&iterate_data),
+                                H5P_DEFAULT);
+    _entries.emplace("/", std::move(root));
+
+    // `visit` descends into a group only the first time it's found.
+    detail::h5o_info1_t info;
+    detail::h5o_get_info_by_name_basic(file.getId(), ".", &info, H5P_DEFAULT);
+    std::map<haddr_t, std::string> groups{{info.addr, "/"}};
+
+    file.visit(
+        [this, &groups](const NodeInfo& node) {
+            std::string path = "/" + node.path;
+            if (node.object_type == ObjectType::Group) {
+                auto inserted = groups.emplace(node.address, path);
+                if (!inserted.second) {
+                    _aliases.emplace(path, inserted.first->second);
+                }
+            }
+
+            Entry entry;
+            entry.object_type = node.object_type;
+            entry.dimensions = node.dimensions;
+            entry.data_type = node.data_type;
+            entry.attribute_names = node.attribute_names;
+            _entries.emplace(std::move(path), std::move(entry));
+        },
+        VisitFields::Dimensions | VisitFields::DataType | VisitFields::AttributeNames);
+}
+
+inline StructureIndex::FileIdentity StructureIndex::FileIdentity::read(const File& file) {
+    FileIdentity identity;
+    hsize_t file_size = 0;
+    detail::h5f_get_filesize(file.getId(), &file_size);
+    identity.size = static_cast<uint64_t>(file_size);
+    identity.free_space = static_cast<uint64_t>(detail::h5f_get_freespace(file.getId()));
+    hsize_t n_root_objects = 0;
+    detail::h5g_get_num_objs(file.getId(), &n_root_objects);
+    identity.n_root_objects = static_cast<uint64_t>(n_root_objects);
+
+#if HIGHFIVE_CXX_STD >= 17
+    // Files which don't exist on disk, e.g. in-memory files, have no
+    // modification time.
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(file.getName(), ec);
+    if (!ec) {
+        identity.mtime = static_cast<int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch())
+                .count());
+    }
+#endif
+
+    return identity;
+}
+
+inline bool StructureIndex::FileIdentity::operator==(const FileIdentity& other) const noexcept {
+    return size == other.size && free_space == other.free_space &&
+           n_root_objects == other.n_root_objects && mtime == other.mtime;
+}
+
+inline bool StructureIndex::matches(const File& file) const {
+    return FileIdentity::read(file) == _file_identity;
+}
+
+inline std::string StructureIndex::normalize(const std::string& path) {
+    std::string normalized = path.empty() || path[0] != '/' ? "/" + path : path;
+    while (normalized.size() > 1 && normalized.back() == '/') {
+        normalized.pop_back();
+    }
+    return normalized;
+}
+
+inline std::string StructureIndex::resolve(const std::string& path) const {
+    auto normalized = normalize(path);
+    if (_aliases.empty()) {
+        return normalized;
+    }
+
+    // Replace every prefix which is an additional hard link to a group, by the
+    // path the group was indexed under.
+    std::string resolved = "/";
+    size_t begin = 1;
+    while (begin < normalized.size()) {
+        size_t end = std::min(normalized.find('/', begin), normalized.size());
+        if (resolved == "/") {
+            resolved.clear();
+        }
+        resolved += normalized.substr(begin - 1, end - begin + 1);
+
+        auto alias = _aliases.find(resolved);
+        if (alias != _aliases.end()) {
+            resolved = alias->second;
+        }
+        begin = end + 1;
+    }
+    return resolved;
+}
+
+inline const StructureIndex::Entry& StructureIndex::getEntry(const std::string& path) const {
+    auto it = _entries.find(resolve(path));
+    if (it == _entries.end()) {
+        throw ObjectException("Object '" + path + "' not found in the structure index.");
+    }
+    return it->second;
+}
+
+inline const StructureIndex::Entry& StructureIndex::getDataSetEntry(
+    const std::string& path) const {
+    const auto& entry = getEntry(path);
+    if (entry.object_type != ObjectType::Dataset) {
+        throw DataSetException("Object '" + path + "' is not a dataset.");
+    }
+    return entry;
+}
+
+inline bool StructureIndex::exist(const std::string& path) const {
+    return _entries.count(resolve(path)) != 0;
+}
+
+inline ObjectType StructureIndex::getObjectType(const std::string& path) const {
+    return getEntry(path).object_type;
+}
+
+inline std::vector<size_t> StructureIndex::getDimensions(const std::string& path) const {
+    return getDataSetEntry(path).dimensions;
+}
+
+inline DataType StructureIndex::getDataType(const std::string& path) const {
+    return getDataSetEntry(path).data_type;
+}
+
+inline std::vector<std::string> StructureIndex::listAttributeNames(const std::string& path) const {
+    return getEntry(path).attribute_names;
+}
+
+inline std::vector<std::string> StructureIndex::listObjectNames(const std::string& path) const {
+    auto resolved = resolve(path);
+    auto it = _entries.find(resolved);
+    if (it == _entries.end() || it->second.object_type != ObjectType::Group) {
+        throw GroupException("Group '" + path + "' not found in the structure index.");
+    }
+
+    // All descendants are consecutive in the map, the deeper ones are skipped.
+    const std::string prefix = resolved == "/" ? resolved : resolved + "/";
+    std::vector<std::string> names;
+    it = _entries.upper_bound(prefix);
+    for (; it != _entries.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+        if (it->first.find('/', prefix.size()) == std::string::npos) {
+            names.push_back(it->first.substr(prefix.size()));
+        }
+    }
+    return names;
+}
+
+inline DataSet StructureIndex::getDataSet(const File& file, const std::string& path) const {
+    getDataSetEntry(path);
+    return file.getDataSet(resolve(path));
+}
+
+inline size_t StructureIndex::size() const noexcept {
+    return _entries.size();
+}
+
+inline void StructureIndex::save(std::ostream& out) const {
+    using details::structure_index_write;
+
+    std::ostringstream os;
+    os.write(details::structure_index_magic, sizeof(details::structure_index_magic));
+    structure_index_write(os, details::structure_index_byte_order);
+    structure_index_write(os, _file_identity.size);
+    structure_index_write(os, _file_identity.free_space);
+    structure_index_write(os, _file_identity.n_root_objects);
+    structure_index_write(os, _file_identity.mtime);
+
+    structure_index_write(os, static_cast<uint64_t>(_entries.size()));
+    std::vector<char> buffer;
+    for (const auto& kv: _entries) {
+        const auto& entry = kv.second;
+        structure_index_write(os, kv.first);
+        structure_index_write(os, static_cast<uint8_t>(entry.object_type));
+
+        structure_index_write(os, static_cast<uint64_t>(entry.dimensions.size()));
+        for (auto dim: entry.dimensions) {
+            structure_index_write(os, static_cast<uint64_t>(dim));
+        }
+
+        // Committed datatypes can't be encoded, their transient copy can.
+        size_t n_bytes = 0;
+        if (!entry.data_type.empty()) {
+            DataType copy(detail::h5t_copy(entry.data_type.getId()));
+            detail::h5t_encode(copy.getId(), nullptr, &n_bytes);
+            buffer.resize(n_bytes);
+            detail::h5t_encode(copy.getId(), buffer.data(), &n_bytes);
+        }
+        structure_index_write(os, static_cast<uint64_t>(n_bytes));
+        os.write(buffer.data(), static_cast<std::streamsize>(n_bytes));
+
+        structure_index_write(os, static_cast<uint64_t>(entry.attribute_names.size()));
+        for (const auto& name: entry.attribute_names) {
+            structure_index_write(os, name);
+        }
+    }
+
+    structure_index_write(os, static_cast<uint64_t>(_aliases.size()));
+    for (const auto& kv: _aliases) {
+        structure_index_write(os, kv.first);
+        structure_index_write(os, kv.second);
+    }
+
+    const auto data = os.str();
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    structure_index_write(out, details::structure_index_checksum(data.data(), data.size()));
+    if (!out) {
+        throw FileException("Unable to write the structure index.");
+    }
+}
+
+inline void StructureIndex::save(const std::string& filename) const {
+    std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+    if (!os) {
+        throw FileException("Unable to open '" + filename + "' to write the structure index.");
+    }
+    save(os);
+}
+
+inline StructureIndex StructureIndex::load(std::istream& in) {
+    using details::structure_index_read;
+    using details::structure_index_read_length;
+    using details::structure_index_read_string;
+
+    // Lengths are validated against the size of the data, and the data against
+    // its checksum, before anything is allocated or passed to HDF5.
+    std::string data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    uint64_t checksum = 0;
+    if (data.size() < sizeof(checksum)) {
+        throw FileException("Not a structure index, or written on an incompatible platform.");
+    }
+    const size_t n_bytes = data.size() - sizeof(checksum);
+    std::copy(data.begin() + static_cast<std::ptrdiff_t>(n_bytes),
+              data.end(),
+              reinterpret_cast<char*>(&checksum));
+    data.resize(n_bytes);
+
+    std::istringstream is(data);
+    char magic[sizeof(details::structure_index_magic)];
+    if (!is.read(magic, sizeof(magic)) ||
+        !std::equal(magic, magic + sizeof(magic), details::structure_index_magic) ||
+        structure_index_read<uint32_t>(is) != details::structure_index_byte_order) {
+        throw FileException("Not a structure index, or written on an incompatible platform.");
+    }
+    if (details::structure_index_checksum(data.data(), data.size()) != checksum) {
+        throw FileException("The structure index is corrupt.");
+    }
+
+    StructureIndex index;
+    index._file_identity.size = structure_index_read<uint64_t>(is);
+    index._file_identity.free_space = structure_index_read<uint64_t>(is);
+    index._file_identity.n_root_objects = structure_index_read<uint64_t>(is);
+    index._file_identity.mtime = structure_index_read<int64_t>(is);
+
+    auto n_entries = structure_index_read<uint64_t>(is);
+    std::vector<char> buffer;
+    for (uint64_t i = 0; i < n_entries; ++i) {
+        auto path = structure_index_read_string(is, n_bytes);
+
+        Entry entry;
+        auto object_type = structure_index_read<uint8_t>(is);
+        if (object_type > static_cast<uint8_t>(ObjectType::Other)) {
+            throw FileException("Unable to read the structure index: invalid object type.");
+        }
+        entry.object_type = static_cast<ObjectType>(object_type);
+
+        entry.dimensions.resize(structure_index_read_length(is, sizeof(uint64_t), n_bytes));
+        for (auto& dim: entry.dimensions) {
+            dim = static_cast<size_t>(structure_index_read<uint64_t>(is));
+        }
+
+        buffer.resize(structure_index_read_length(is, 1, n_bytes));
+        if (!buffer.empty()) {
+            if (!is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()))) {
+                throw FileException(
+                    "Unable to read the structure index: unexpected end of data.");
+            }
+            entry.data_type = DataType(detail::h5t_decode(buffer.data()));
+        }
+
+        // Every name is preceded by its length.
+        entry.attribute_names.resize(structure_index_read_length(is, sizeof(uint64_t), n_bytes));
+        for (auto& name: entry.attribute_names) {
+            name = structure_index_read_string(is, n_bytes);
+        }
+
+        index._entries.emplace(std::move(path), std::move(entry));
+    }
+
+    auto n_aliases = structure_index_read<uint64_t>(is);
+    for (uint64_t i = 0; i < n_aliases; ++i) {
+        auto alias = structure_index_read_string(is, n_bytes);
+        index._aliases.emplace(std::move(alias), structure_index_read_string(is, n_bytes));
+    }
+
+    return index;
+}
+
+inline StructureIndex StructureIndex::load(const std::string& filename) {
+    std::ifstream is(filename, std::ios::binary);
+    if (!is) {
+        throw FileException("Unable to open the structure index '" + filename + "'.");
+    }
+    return load(is);
+}
+
+inline StructureIndex StructureIndex::loadOrBuild(const File& file, const std::string& filename) {
+    std::ifstream is(filename, std::ios::binary);
+    if (is) {
+        try {
+            auto index = load(is);
+            if (index.matches(file)) {
+                return index;
+            }
+        } catch (const std::exception&) {
+            // An unreadable index is rebuilt.
+        }
+    }
+
+    StructureIndex index(file);
+    std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+    if (os) {
+        try {
+            index.save(os);
+        } catch (const Exception&) {
+            // The index is still usable, it'll be rebuilt next time.
+        }
+    }
+    return index;
+}
+
+}  // namespace HighFive
@@ -0,0 +1,123 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <H5Ppublic.h>
+
+#include "../H5PropertyList.hpp"
+#include "h5p_wrapper.hpp"
+
+namespace HighFive {
+namespace details {
+
+///
+/// \brief Memory for the variable length elements of a single read.
+///
+/// HDF5 allocates every variable length element, e.g. every string, with
+/// `malloc` and they must be reclaimed one by one after the read. Once
+/// installed as the memory manager of a transfer, the arena carves the
+/// elements from large blocks instead, which are all released with the arena.
+///
+/// The exact size could be obtained from `H5Dvlen_get_buf_size`, but it reads
+/// the selection an additional time, one element at a time. Therefore the
+/// blocks grow geometrically.
+class VlenArena {
+  public:
+    ///
+    /// \brief An arena for elements aligned to `alignment` bytes.
+    ///
+    /// Strings need no alignment, other variable length data is aligned like
+    /// `malloc` by default.
+    explicit VlenArena(size_t alignment = alignof(std::max_align_t))
+        : _alignment(alignment) {}
+
+    VlenArena(const VlenArena&) = delete;
+    VlenArena& operator=(const VlenArena&) = delete;
+
+    ///
+    /// \brief Install the arena in a copy of `xfer_props`.
+    ///
+    /// Returns `false`, and leaves `arena_props` untouched, if `xfer_props`
+    /// already has a memory manager for variable length data.
+    bool install(const DataTransferProps& xfer_props, DataTransferProps& arena_props) const {
+        if (xfer_props.getId() != H5P_DEFAULT) {
+            H5MM_allocate_t alloc_func = nullptr;
+            H5MM_free_t free_func = nullptr;
+            void* alloc_info = nullptr;
+            void* free_info = nullptr;
+            detail::h5p_get_vlen_mem_manager(
+                xfer_props.getId(), &alloc_func, &alloc_info, &free_func, &free_info);
+            if (alloc_func != nullptr || free_func != nullptr) {
+                return false;
+            }
+            arena_props = details::get_plist<DataTransferProps>(xfer_props, H5Pcopy);
+        }
+        arena_props.add(*this);
+        return true;
+    }
+
+    ///
+    /// \brief Allocate `size` bytes.
+    ///
+    void* allocate(size_t size) {
+        size = std::max((size + _alignment - 1) / _alignment * _alignment, _alignment);
+        if (size > _remaining) {
+            const size_t block_size = std::max(size, _block_size);
+            _blocks.emplace_back(new char[block_size]);
+            _next = _blocks.back().get();
+            _remaining = block_size;
+            _block_size = std::min(2 * _block_size, size_t(64 * 1024 * 1024));
+        }
+
+        void* ptr = _next;
+        _next += size;
+        _remaining -= size;
+        return ptr;
+    }
+
+    /// \brief The number of blocks allocated so far.
+    size_t getBlockCount() const noexcept {
+        return _blocks.size();
+    }
+
+  private:
+    friend DataTransferProps;
+
+    void apply(hid_t hid) const {
+        // The callbacks modify the arena, not the property.
+        auto info = static_cast<void*>(const_cast<VlenArena*>(this));
+        detail::h5p_set_vlen_mem_manager(hid, &allocate_callback, info, &free_callback, info);
+    }
+
+    static void* allocate_callback(size_t size, void* info) noexcept {
+        try {
+            return static_cast<VlenArena*>(info)->allocate(size);
+        } catch (const std::bad_alloc&) {
+            return nullptr;
+        }
+    }
+
+    // The memory is released with the arena.
+    static void free_callback(void* /* ptr */, void* /* info */) noexcept {}
+
+    size_t _alignment;
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    char* _next = nullptr;
+    size_t _remaining = 0;
+    size_t _block_size = 64 * 1024;
+};
+
+}  // namespace details
+}  // namespace HighFive
@@ -1,9 +1,12 @@
 #pragma once
 #include <H5public.h>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 inline void h5_free_memory(void* mem) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     if (H5free_memory(mem) < 0) {
         throw DataTypeException("Could not free memory allocated by HDF5");
     }
@@ -11,6 +14,7 @@ inline void h5_free_memory(void* mem) {
 
 namespace nothrow {
 inline herr_t h5_free_memory(void* mem) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     return H5free_memory(mem);
 }
 }  // namespace nothrow
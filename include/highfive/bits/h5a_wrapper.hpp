@@ -3,6 +3,8 @@
 #include <H5Apublic.h>
 #include <H5Ipublic.h>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 
@@ -12,16 +14,19 @@ inline hid_t h5a_create2(hid_t loc_id,
                          hid_t space_id,
                          hid_t acpl_id,
                          hid_t aapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     auto attr_id = H5Acreate2(loc_id, attr_name, type_id, space_id, acpl_id, aapl_id);
     if (attr_id < 0) {
         HDF5ErrMapper::ToException<AttributeException>(
             std::string("Unable to create the attribute \"") + attr_name + "\":");
     }
 
+    HIGHFIVE_INSTRUMENT_RESULT(attr_id);
     return attr_id;
 }
 
 inline void h5a_delete(hid_t loc_id, char const* const attr_name) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     if (H5Adelete(loc_id, attr_name) < 0) {
         HDF5ErrMapper::ToException<AttributeException>(
             std::string("Unable to delete attribute \"") + attr_name + "\":");
@@ -29,6 +34,7 @@ inline void h5a_delete(hid_t loc_id, char const* const attr_name) {
 }
 
 inline hid_t h5a_open(hid_t loc_id, char const* const attr_name, hid_t aapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     const auto attr_id = H5Aopen(loc_id, attr_name, aapl_id);
     if (attr_id < 0) {
         HDF5ErrMapper::ToException<AttributeException>(
@@ -40,6 +46,7 @@ inline hid_t h5a_open(hid_t loc_id, char const* const attr_name, hid_t aapl_id)
 
 
 inline int h5a_get_num_attrs(hid_t loc_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     int res = H5Aget_num_attrs(loc_id);
     if (res < 0) {
         HDF5ErrMapper::ToException<AttributeException>(
@@ -56,12 +63,29 @@ inline void h5a_iterate2(hid_t loc_id,
                          hsize_t* idx,
                          H5A_operator2_t op,
                          void* op_data) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     if (H5Aiterate2(loc_id, idx_type, order, idx, op, op_data) < 0) {
         HDF5ErrMapper::ToException<AttributeException>(std::string("Failed H5Aiterate2."));
     }
 }
 
+inline void h5a_iterate_by_name(hid_t loc_id,
+                                const char* obj_name,
+                                H5_index_t idx_type,
+                                H5_iter_order_t order,
+                                hsize_t* idx,
+                                H5A_operator2_t op,
+                                void* op_data,
+                                hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
+    if (H5Aiterate_by_name(loc_id, obj_name, idx_type, order, idx, op, op_data, lapl_id) < 0) {
+        HDF5ErrMapper::ToException<AttributeException>(
+            std::string("Failed H5Aiterate_by_name for \"") + obj_name + "\".");
+    }
+}
+
 inline int h5a_exists(hid_t obj_id, char const* const attr_name) {
+    HIGHFIVE_INSTRUMENT(obj_id);
     int res = H5Aexists(obj_id, attr_name);
     if (res < 0) {
         HDF5ErrMapper::ToException<AttributeException>(
@@ -72,6 +96,7 @@ inline int h5a_exists(hid_t obj_id, char const* const attr_name) {
 }
 
 inline ssize_t h5a_get_name(hid_t attr_id, size_t buf_size, char* buf) {
+    HIGHFIVE_INSTRUMENT(attr_id);
     ssize_t name_length = H5Aget_name(attr_id, buf_size, buf);
     if (name_length < 0) {
         HDF5ErrMapper::ToException<AttributeException>(
@@ -83,6 +108,7 @@ inline ssize_t h5a_get_name(hid_t attr_id, size_t buf_size, char* buf) {
 
 
 inline hid_t h5a_get_space(hid_t attr_id) {
+    HIGHFIVE_INSTRUMENT(attr_id);
     hid_t attr = H5Aget_space(attr_id);
     if (attr < 0) {
         HDF5ErrMapper::ToException<AttributeException>(
@@ -93,6 +119,7 @@ inline hid_t h5a_get_space(hid_t attr_id) {
 }
 
 inline hsize_t h5a_get_storage_size(hid_t attr_id) {
+    HIGHFIVE_INSTRUMENT(attr_id);
     // Docs:
     //    Returns the amount of storage size allocated for the attribute;
     //    otherwise returns 0 (zero).
@@ -100,6 +127,7 @@ inline hsize_t h5a_get_storage_size(hid_t attr_id) {
 }
 
 inline hid_t h5a_get_type(hid_t attr_id) {
+    HIGHFIVE_INSTRUMENT(attr_id);
     hid_t type_id = H5Aget_type(attr_id);
     if (type_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<AttributeException>(
@@ -110,6 +138,7 @@ inline hid_t h5a_get_type(hid_t attr_id) {
 }
 
 inline herr_t h5a_read(hid_t attr_id, hid_t type_id, void* buf) {
+    HIGHFIVE_INSTRUMENT_TRANSFER(attr_id, type_id, H5S_ALL, H5S_ALL);
     herr_t err = H5Aread(attr_id, type_id, buf);
     if (err < 0) {
         HDF5ErrMapper::ToException<AttributeException>(std::string("Unable to read attribute"));
@@ -119,6 +148,7 @@ inline herr_t h5a_read(hid_t attr_id, hid_t type_id, void* buf) {
 }
 
 inline herr_t h5a_write(hid_t attr_id, hid_t type_id, void const* buf) {
+    HIGHFIVE_INSTRUMENT_TRANSFER(attr_id, type_id, H5S_ALL, H5S_ALL);
     herr_t err = H5Awrite(attr_id, type_id, buf);
     if (err < 0) {
         HDF5ErrMapper::ToException<AttributeException>(std::string("Unable to write attribute"));
@@ -3,12 +3,23 @@
 #include <H5Dpublic.h>
 #include <H5Ipublic.h>
 
+#include "H5Instrumentation.hpp"
+
+// `H5Dchunk_iter` was added in 1.14.0 and backported to 1.12.3; the 1.13
+// development releases have an incompatible callback.
+#if H5_VERSION_GE(1, 14, 0) || (H5_VERSION_GE(1, 12, 3) && !H5_VERSION_GE(1, 13, 0))
+#define HIGHFIVE_HAS_CHUNK_ITER 1
+#else
+#define HIGHFIVE_HAS_CHUNK_ITER 0
+#endif
+
 namespace HighFive {
 namespace detail {
 
 
 #if !H5_VERSION_GE(1, 12, 0)
 inline herr_t h5d_vlen_reclaim(hid_t type_id, hid_t space_id, hid_t dxpl_id, void* buf) {
+    HIGHFIVE_INSTRUMENT(type_id);
     herr_t err = H5Dvlen_reclaim(type_id, space_id, dxpl_id, buf);
     if (err < 0) {
         throw DataSetException("Failed to reclaim HDF5 internal memory");
@@ -19,6 +30,7 @@ inline herr_t h5d_vlen_reclaim(hid_t type_id, hid_t space_id, hid_t dxpl_id, voi
 #endif
 
 inline hsize_t h5d_get_storage_size(hid_t dset_id) {
+    HIGHFIVE_INSTRUMENT(dset_id);
     // Docs:
     //    H5Dget_storage_size() does not differentiate between 0 (zero), the
     //    value returned for the storage size of a dataset with no stored values,
@@ -26,7 +38,67 @@ inline hsize_t h5d_get_storage_size(hid_t dset_id) {
     return H5Dget_storage_size(dset_id);
 }
 
+#if H5_VERSION_GE(1, 10, 5)
+inline herr_t h5d_get_num_chunks(hid_t dset_id, hid_t fspace_id, hsize_t* nchunks) {
+    HIGHFIVE_INSTRUMENT(dset_id);
+    herr_t err = H5Dget_num_chunks(dset_id, fspace_id, nchunks);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            std::string("Unable to get the number of allocated chunks"));
+    }
+
+    return err;
+}
+
+inline herr_t h5d_get_chunk_info(hid_t dset_id,
+                                 hid_t fspace_id,
+                                 hsize_t chk_idx,
+                                 hsize_t* offset,
+                                 unsigned* filter_mask,
+                                 haddr_t* addr,
+                                 hsize_t* size) {
+    HIGHFIVE_INSTRUMENT(dset_id);
+    herr_t err = H5Dget_chunk_info(dset_id, fspace_id, chk_idx, offset, filter_mask, addr, size);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            std::string("Unable to get information about chunk ") + std::to_string(chk_idx));
+    }
+
+    return err;
+}
+
+// Unallocated chunks aren't an error, their address is `HADDR_UNDEF`.
+inline herr_t h5d_get_chunk_info_by_coord(hid_t dset_id,
+                                          const hsize_t* offset,
+                                          unsigned* filter_mask,
+                                          haddr_t* addr,
+                                          hsize_t* size) {
+    HIGHFIVE_INSTRUMENT(dset_id);
+    herr_t err = H5Dget_chunk_info_by_coord(dset_id, offset, filter_mask, addr, size);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            std::string("Unable to get information about a chunk by its coordinates"));
+    }
+
+    return err;
+}
+#endif
+
+#if HIGHFIVE_HAS_CHUNK_ITER
+inline herr_t h5d_chunk_iter(hid_t dset_id, hid_t dxpl_id, H5D_chunk_iter_op_t cb, void* op_data) {
+    HIGHFIVE_INSTRUMENT(dset_id);
+    herr_t err = H5Dchunk_iter(dset_id, dxpl_id, cb, op_data);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            std::string("Unable to iterate over the allocated chunks"));
+    }
+
+    return err;
+}
+#endif
+
 inline hid_t h5d_get_space(hid_t dset_id) {
+    HIGHFIVE_INSTRUMENT(dset_id);
     hid_t dset = H5Dget_space(dset_id);
     if (dset == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<DataSetException>(
@@ -37,6 +109,7 @@ inline hid_t h5d_get_space(hid_t dset_id) {
 }
 
 inline hid_t h5d_get_type(hid_t dset_id) {
+    HIGHFIVE_INSTRUMENT(dset_id);
     hid_t type_id = H5Dget_type(dset_id);
     if (type_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<DataSetException>(
@@ -52,6 +125,7 @@ inline herr_t h5d_read(hid_t dset_id,
                        hid_t file_space_id,
                        hid_t dxpl_id,
                        void* buf) {
+    HIGHFIVE_INSTRUMENT_TRANSFER(dset_id, mem_type_id, mem_space_id, file_space_id);
     herr_t err = H5Dread(dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataSetException>(std::string("Unable to read the dataset"));
@@ -66,6 +140,7 @@ inline herr_t h5d_write(hid_t dset_id,
                         hid_t file_space_id,
                         hid_t dxpl_id,
                         const void* buf) {
+    HIGHFIVE_INSTRUMENT_TRANSFER(dset_id, mem_type_id, mem_space_id, file_space_id);
     herr_t err = H5Dwrite(dset_id, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataSetException>(std::string("Unable to write the dataset"));
@@ -74,7 +149,22 @@ inline herr_t h5d_write(hid_t dset_id,
     return err;
 }
 
+inline herr_t h5d_fill(const void* fill,
+                       hid_t fill_type_id,
+                       void* buf,
+                       hid_t buf_type_id,
+                       hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
+    herr_t err = H5Dfill(fill, fill_type_id, buf, buf_type_id, space_id);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(std::string("Unable to fill the buffer"));
+    }
+
+    return err;
+}
+
 inline haddr_t h5d_get_offset(hid_t dset_id) {
+    HIGHFIVE_INSTRUMENT(dset_id);
     uint64_t addr = H5Dget_offset(dset_id);
     if (addr == HADDR_UNDEF) {
         HDF5ErrMapper::ToException<DataSetException>("Cannot get offset of DataSet.");
@@ -84,6 +174,7 @@ inline haddr_t h5d_get_offset(hid_t dset_id) {
 
 
 inline herr_t h5d_set_extent(hid_t dset_id, const hsize_t size[]) {
+    HIGHFIVE_INSTRUMENT(dset_id);
     herr_t err = H5Dset_extent(dset_id, size);
     if (H5Dset_extent(dset_id, size) < 0) {
         HDF5ErrMapper::ToException<DataSetException>("Could not resize dataset.");
@@ -99,6 +190,7 @@ inline hid_t h5d_create2(hid_t loc_id,
                          hid_t lcpl_id,
                          hid_t dcpl_id,
                          hid_t dapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     hid_t dataset_id = H5Dcreate2(loc_id, name, type_id, space_id, lcpl_id, dcpl_id, dapl_id);
 
     if (dataset_id == H5I_INVALID_HID) {
@@ -106,10 +198,19 @@ inline hid_t h5d_create2(hid_t loc_id,
             std::string("Failed to create the dataset \"") + name + "\":");
     }
 
+    HIGHFIVE_INSTRUMENT_RESULT(dataset_id);
     return dataset_id;
 }
 
+namespace nothrow {
+inline hid_t h5d_open2(hid_t loc_id, const char* name, hid_t dapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
+    return H5Dopen2(loc_id, name, dapl_id);
+}
+}  // namespace nothrow
+
 inline hid_t h5d_open2(hid_t loc_id, const char* name, hid_t dapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     hid_t dataset_id = H5Dopen2(loc_id, name, dapl_id);
 
     if (dataset_id == H5I_INVALID_HID) {
@@ -1,15 +1,20 @@
 #pragma once
 
 #include <H5Fpublic.h>
+
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 namespace nothrow {
 inline hid_t h5f_open(const char* filename, unsigned flags, hid_t fapl_id) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     return H5Fopen(filename, flags, fapl_id);
 }
 }  // namespace nothrow
 
 inline hid_t h5f_create(const char* filename, unsigned flags, hid_t fcpl_id, hid_t fapl_id) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     hid_t file_id = H5Fcreate(filename, flags, fcpl_id, fapl_id);
 
     if (file_id == H5I_INVALID_HID) {
@@ -19,6 +24,7 @@ inline hid_t h5f_create(const char* filename, unsigned flags, hid_t fcpl_id, hid
 }
 
 inline ssize_t h5f_get_name(hid_t obj_id, char* name, size_t size) {
+    HIGHFIVE_INSTRUMENT(obj_id);
     ssize_t nread = H5Fget_name(obj_id, name, size);
     if (nread < 0) {
         HDF5ErrMapper::ToException<FileException>(std::string("Failed to get file from id"));
@@ -28,6 +34,7 @@ inline ssize_t h5f_get_name(hid_t obj_id, char* name, size_t size) {
 }
 
 inline herr_t h5f_flush(hid_t object_id, H5F_scope_t scope) {
+    HIGHFIVE_INSTRUMENT(object_id);
     herr_t err = H5Fflush(object_id, scope);
     if (err < 0) {
         HDF5ErrMapper::ToException<FileException>(std::string("Failed to flush file"));
@@ -37,6 +44,7 @@ inline herr_t h5f_flush(hid_t object_id, H5F_scope_t scope) {
 }
 
 inline herr_t h5f_get_filesize(hid_t file_id, hsize_t* size) {
+    HIGHFIVE_INSTRUMENT(file_id);
     herr_t err = H5Fget_filesize(file_id, size);
     if (err < 0) {
         HDF5ErrMapper::ToException<FileException>(std::string("Unable to retrieve size of file"));
@@ -46,6 +54,7 @@ inline herr_t h5f_get_filesize(hid_t file_id, hsize_t* size) {
 }
 
 inline hssize_t h5f_get_freespace(hid_t file_id) {
+    HIGHFIVE_INSTRUMENT(file_id);
     hssize_t free_space = H5Fget_freespace(file_id);
     if (free_space < 0) {
         HDF5ErrMapper::ToException<FileException>(
@@ -54,5 +63,105 @@ inline hssize_t h5f_get_freespace(hid_t file_id) {
     return free_space;
 }
 
+#if H5_VERSION_GE(1, 10, 0)
+inline herr_t h5f_get_info2(hid_t obj_id, H5F_info2_t* file_info) {
+    HIGHFIVE_INSTRUMENT(obj_id);
+    herr_t err = H5Fget_info2(obj_id, file_info);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(std::string("Unable to retrieve file info"));
+    }
+
+    return err;
+}
+#endif
+
+inline herr_t h5f_get_mdc_hit_rate(hid_t file_id, double* hit_rate) {
+    HIGHFIVE_INSTRUMENT(file_id);
+    herr_t err = H5Fget_mdc_hit_rate(file_id, hit_rate);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to retrieve the hit rate of the metadata cache"));
+    }
+
+    return err;
+}
+
+inline herr_t h5f_reset_mdc_hit_rate_stats(hid_t file_id) {
+    HIGHFIVE_INSTRUMENT(file_id);
+    herr_t err = H5Freset_mdc_hit_rate_stats(file_id);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to reset the hit rate of the metadata cache"));
+    }
+
+    return err;
+}
+
+inline herr_t h5f_get_mdc_size(hid_t file_id,
+                               size_t* max_size,
+                               size_t* min_clean_size,
+                               size_t* cur_size,
+                               int* cur_num_entries) {
+    HIGHFIVE_INSTRUMENT(file_id);
+    herr_t err = H5Fget_mdc_size(file_id, max_size, min_clean_size, cur_size, cur_num_entries);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to retrieve the size of the metadata cache"));
+    }
+
+    return err;
+}
+
+inline herr_t h5f_get_mdc_config(hid_t file_id, H5AC_cache_config_t* config) {
+    HIGHFIVE_INSTRUMENT(file_id);
+    herr_t err = H5Fget_mdc_config(file_id, config);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to retrieve the configuration of the metadata cache"));
+    }
+
+    return err;
+}
+
+inline herr_t h5f_set_mdc_config(hid_t file_id, const H5AC_cache_config_t* config) {
+    HIGHFIVE_INSTRUMENT(file_id);
+    herr_t err = H5Fset_mdc_config(file_id, const_cast<H5AC_cache_config_t*>(config));
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to configure the metadata cache"));
+    }
+
+    return err;
+}
+
+#if H5_VERSION_GE(1, 10, 1)
+inline herr_t h5f_get_page_buffering_stats(hid_t file_id,
+                                           unsigned accesses[2],
+                                           unsigned hits[2],
+                                           unsigned misses[2],
+                                           unsigned evictions[2],
+                                           unsigned bypasses[2]) {
+    HIGHFIVE_INSTRUMENT(file_id);
+    herr_t err = H5Fget_page_buffering_stats(file_id, accesses, hits, misses, evictions, bypasses);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to retrieve the statistics of the page buffer"));
+    }
+
+    return err;
+}
+
+inline herr_t h5f_reset_page_buffering_stats(hid_t file_id) {
+    HIGHFIVE_INSTRUMENT(file_id);
+    herr_t err = H5Freset_page_buffering_stats(file_id);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<FileException>(
+            std::string("Unable to reset the statistics of the page buffer"));
+    }
+
+    return err;
+}
+#endif
+
 }  // namespace detail
 }  // namespace HighFive
@@ -5,6 +5,8 @@
 
 #include <highfive/H5Exception.hpp>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 
@@ -13,6 +15,7 @@ inline hid_t h5g_create2(hid_t loc_id,
                          hid_t lcpl_id,
                          hid_t gcpl_id,
                          hid_t gapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     hid_t group_id = H5Gcreate2(loc_id, name, lcpl_id, gcpl_id, gapl_id);
     if (group_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to create the group \"") +
@@ -23,6 +26,7 @@ inline hid_t h5g_create2(hid_t loc_id,
 }
 
 inline hid_t h5g_open2(hid_t loc_id, const char* name, hid_t gapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     hid_t group_id = H5Gopen2(loc_id, name, gapl_id);
     if (group_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to open the group \"") +
@@ -32,6 +36,7 @@ inline hid_t h5g_open2(hid_t loc_id, const char* name, hid_t gapl_id) {
 }
 
 inline herr_t h5g_get_num_objs(hid_t loc_id, hsize_t* num_objs) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     herr_t err = H5Gget_num_objs(loc_id, num_objs);
     if (err < 0) {
         HDF5ErrMapper::ToException<GroupException>(
@@ -2,9 +2,34 @@
 
 #include <H5Ipublic.h>
 
+#include "H5Instrumentation.hpp"
+
+#ifdef HIGHFIVE_COUNT_REFERENCE_OPERATIONS
+#include <atomic>
+#endif
+
 namespace HighFive {
 namespace detail {
+
+#ifdef HIGHFIVE_COUNT_REFERENCE_OPERATIONS
+// The number of calls to `H5Iinc_ref` and `H5Idec_ref` made by HighFive. This
+// is meant for testing, define `HIGHFIVE_COUNT_REFERENCE_OPERATIONS` before
+// including HighFive to enable it.
+inline std::atomic<size_t>& reference_operation_count() {
+    static std::atomic<size_t> count(0);
+    return count;
+}
+#endif
+
+inline void count_reference_operation() noexcept {
+#ifdef HIGHFIVE_COUNT_REFERENCE_OPERATIONS
+    ++reference_operation_count();
+#endif
+}
+
 inline int h5i_inc_ref(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
+    count_reference_operation();
     auto count = H5Iinc_ref(id);
 
     if (count < 0) {
@@ -17,12 +42,16 @@ inline int h5i_inc_ref(hid_t id) {
 namespace nothrow {
 
 inline int h5i_dec_ref(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
+    count_reference_operation();
     return H5Idec_ref(id);
 }
 
 }  // namespace nothrow
 
 inline int h5i_dec_ref(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
+    count_reference_operation();
     int count = H5Idec_ref(id);
     if (count < 0) {
         throw ObjectException("Failed to decrease reference count of HID");
@@ -33,12 +62,14 @@ inline int h5i_dec_ref(hid_t id) {
 
 namespace nothrow {
 inline htri_t h5i_is_valid(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
     return H5Iis_valid(id);
 }
 
 }  // namespace nothrow
 
 inline htri_t h5i_is_valid(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
     htri_t tri = H5Iis_valid(id);
     if (tri < 0) {
         throw ObjectException("Failed to check if HID is valid");
@@ -48,6 +79,7 @@ inline htri_t h5i_is_valid(hid_t id) {
 }
 
 inline H5I_type_t h5i_get_type(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
     H5I_type_t type = H5Iget_type(id);
     if (type == H5I_BADID) {
         HDF5ErrMapper::ToException<ObjectException>("Failed to get type of HID");
@@ -58,6 +90,7 @@ inline H5I_type_t h5i_get_type(hid_t id) {
 
 template <class Exception>
 inline hid_t h5i_get_file_id(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
     hid_t file_id = H5Iget_file_id(id);
     if (file_id < 0) {
         HDF5ErrMapper::ToException<Exception>("Failed not obtain file HID of object");
@@ -67,6 +100,7 @@ inline hid_t h5i_get_file_id(hid_t id) {
 }
 
 inline ssize_t h5i_get_name(hid_t id, char* name, size_t size) {
+    HIGHFIVE_INSTRUMENT(id);
     ssize_t n_chars = H5Iget_name(id, name, size);
     if (n_chars < 0) {
         HDF5ErrMapper::ToException<ObjectException>("Failed to get name of HID.");
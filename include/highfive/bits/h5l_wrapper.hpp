@@ -2,6 +2,8 @@
 
 #include <H5Lpublic.h>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 
@@ -11,6 +13,7 @@ inline herr_t h5l_create_external(const char* file_name,
                                   const char* link_name,
                                   hid_t lcpl_id,
                                   hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     herr_t err = H5Lcreate_external(file_name, obj_name, link_loc_id, link_name, lcpl_id, lapl_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to create external link: "));
@@ -24,6 +27,7 @@ inline herr_t h5l_create_soft(const char* link_target,
                               const char* link_name,
                               hid_t lcpl_id,
                               hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     herr_t err = H5Lcreate_soft(link_target, link_loc_id, link_name, lcpl_id, lapl_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to create soft link: "));
@@ -38,6 +42,7 @@ inline herr_t h5l_create_hard(hid_t cur_loc,
                               const char* dst_name,
                               hid_t lcpl_id,
                               hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(cur_loc);
     herr_t err = H5Lcreate_hard(cur_loc, cur_name, dst_loc, dst_name, lcpl_id, lapl_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to create hard link: "));
@@ -47,6 +52,7 @@ inline herr_t h5l_create_hard(hid_t cur_loc,
 }
 
 inline herr_t h5l_get_info(hid_t loc_id, const char* name, H5L_info_t* linfo, hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     herr_t err = H5Lget_info(loc_id, name, linfo, lapl_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to obtain info for link "));
@@ -56,6 +62,7 @@ inline herr_t h5l_get_info(hid_t loc_id, const char* name, H5L_info_t* linfo, hi
 }
 
 inline herr_t h5l_delete(hid_t loc_id, const char* name, hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     herr_t err = H5Ldelete(loc_id, name, lapl_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Invalid name for unlink() "));
@@ -65,6 +72,7 @@ inline herr_t h5l_delete(hid_t loc_id, const char* name, hid_t lapl_id) {
 }
 
 inline htri_t h5l_exists(hid_t loc_id, const char* name, hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     htri_t tri = H5Lexists(loc_id, name, lapl_id);
     if (tri < 0) {
         HDF5ErrMapper::ToException<GroupException>("Invalid link for exist()");
@@ -76,6 +84,7 @@ inline htri_t h5l_exists(hid_t loc_id, const char* name, hid_t lapl_id) {
 namespace nothrow {
 
 inline htri_t h5l_exists(hid_t loc_id, const char* name, hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     return H5Lexists(loc_id, name, lapl_id);
 }
 
@@ -87,6 +96,7 @@ inline herr_t h5l_iterate(hid_t grp_id,
                           hsize_t* idx,
                           H5L_iterate_t op,
                           void* op_data) {
+    HIGHFIVE_INSTRUMENT(grp_id);
     herr_t err = H5Literate(grp_id, idx_type, order, idx, op, op_data);
     if (err < 0) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to list objects in group"));
@@ -100,6 +110,7 @@ inline herr_t h5l_move(hid_t src_loc,
                        const char* dst_name,
                        hid_t lcpl_id,
                        hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(src_loc);
     herr_t err = H5Lmove(src_loc, src_name, dst_loc, dst_name, lcpl_id, lapl_id);
 
     if (err < 0) {
@@ -117,6 +128,7 @@ inline ssize_t h5l_get_name_by_idx(hid_t loc_id,
                                    char* name,
                                    size_t size,
                                    hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     ssize_t n_chars =
         H5Lget_name_by_idx(loc_id, group_name, idx_type, order, n, name, size, lapl_id);
 
@@ -3,10 +3,13 @@
 #include <H5Ipublic.h>
 #include <H5Tpublic.h>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 
 inline hid_t h5o_open(hid_t loc_id, const char* name, hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     hid_t hid = H5Oopen(loc_id, name, lapl_id);
     if (hid < 0) {
         HDF5ErrMapper::ToException<GroupException>(std::string("Unable to open \"") + name + "\":");
@@ -15,7 +18,33 @@ inline hid_t h5o_open(hid_t loc_id, const char* name, hid_t lapl_id) {
     return hid;
 }
 
+#if (H5Oget_info_vers < 3)
+using h5o_info1_t = H5O_info_t;
+#else
+using h5o_info1_t = H5O_info1_t;
+#endif
+
+// Only retrieves the basic fields, i.e. type, address and reference count.
+inline herr_t h5o_get_info_by_name_basic(hid_t loc_id,
+                                         const char* name,
+                                         h5o_info1_t* oinfo,
+                                         hid_t lapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
+#if H5_VERSION_GE(1, 10, 3)
+    herr_t err = H5Oget_info_by_name2(loc_id, name, oinfo, H5O_INFO_BASIC, lapl_id);
+#else
+    herr_t err = H5Oget_info_by_name(loc_id, name, oinfo, lapl_id);
+#endif
+    if (err < 0) {
+        HDF5ErrMapper::ToException<ObjectException>(std::string("Unable to get info of \"") +
+                                                     name + "\":");
+    }
+
+    return err;
+}
+
 inline herr_t h5o_close(hid_t id) {
+    HIGHFIVE_INSTRUMENT(id);
     herr_t err = H5Oclose(id);
     if (err < 0) {
         HDF5ErrMapper::ToException<ObjectException>("Unable to close object.");
@@ -3,9 +3,12 @@
 #include <H5Ipublic.h>
 #include <H5Ppublic.h>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 inline hid_t h5p_create(hid_t cls_id) {
+    HIGHFIVE_INSTRUMENT(cls_id);
     hid_t plist_id = H5Pcreate(cls_id);
     if (plist_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<PropertyException>("Failed to create property list");
@@ -19,6 +22,7 @@ inline herr_t h5p_set_file_space_strategy(hid_t plist_id,
                                           H5F_fspace_strategy_t strategy,
                                           hbool_t persist,
                                           hsize_t threshold) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_file_space_strategy(plist_id, strategy, persist, threshold);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Unable to get file space strategy");
@@ -31,6 +35,7 @@ inline herr_t h5p_get_file_space_strategy(hid_t plist_id,
                                           H5F_fspace_strategy_t* strategy,
                                           hbool_t* persist,
                                           hsize_t* threshold) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_file_space_strategy(plist_id, strategy, persist, threshold);
     if (err) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting file space strategy.");
@@ -40,6 +45,7 @@ inline herr_t h5p_get_file_space_strategy(hid_t plist_id,
 }
 
 inline herr_t h5p_set_file_space_page_size(hid_t plist_id, hsize_t fsp_size) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_file_space_page_size(plist_id, fsp_size);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting file space page size.");
@@ -49,6 +55,7 @@ inline herr_t h5p_set_file_space_page_size(hid_t plist_id, hsize_t fsp_size) {
 }
 
 inline herr_t h5p_get_file_space_page_size(hid_t plist_id, hsize_t* fsp_size) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_file_space_page_size(plist_id, fsp_size);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Unable to get file space page size");
@@ -62,6 +69,7 @@ inline herr_t h5p_get_page_buffer_size(hid_t plist_id,
                                        size_t* buf_size,
                                        unsigned* min_meta_perc,
                                        unsigned* min_raw_perc) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_page_buffer_size(plist_id, buf_size, min_meta_perc, min_raw_perc);
 
     if (err < 0) {
@@ -75,6 +83,7 @@ inline herr_t h5p_set_page_buffer_size(hid_t plist_id,
                                        size_t buf_size,
                                        unsigned min_meta_per,
                                        unsigned min_raw_per) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_page_buffer_size(plist_id, buf_size, min_meta_per, min_raw_per);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting page buffer size.");
@@ -87,6 +96,7 @@ inline herr_t h5p_set_page_buffer_size(hid_t plist_id,
 
 #ifdef H5_HAVE_PARALLEL
 inline herr_t h5p_set_fapl_mpio(hid_t fapl_id, MPI_Comm comm, MPI_Info info) {
+    HIGHFIVE_INSTRUMENT(fapl_id);
     herr_t err = H5Pset_fapl_mpio(fapl_id, comm, info);
     if (err < 0) {
         HDF5ErrMapper::ToException<FileException>("Unable to set-up MPIO Driver configuration");
@@ -97,6 +107,7 @@ inline herr_t h5p_set_fapl_mpio(hid_t fapl_id, MPI_Comm comm, MPI_Info info) {
 
 #if H5_VERSION_GE(1, 10, 0)
 inline herr_t h5p_set_all_coll_metadata_ops(hid_t plist_id, hbool_t is_collective) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_all_coll_metadata_ops(plist_id, is_collective);
     if (err < 0) {
         HDF5ErrMapper::ToException<FileException>("Unable to request collective metadata reads");
@@ -106,6 +117,7 @@ inline herr_t h5p_set_all_coll_metadata_ops(hid_t plist_id, hbool_t is_collectiv
 }
 
 inline herr_t h5p_get_all_coll_metadata_ops(hid_t plist_id, hbool_t* is_collective) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_all_coll_metadata_ops(plist_id, is_collective);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error loading MPI metadata read.");
@@ -115,6 +127,7 @@ inline herr_t h5p_get_all_coll_metadata_ops(hid_t plist_id, hbool_t* is_collecti
 }
 
 inline herr_t h5p_set_coll_metadata_write(hid_t plist_id, hbool_t is_collective) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_coll_metadata_write(plist_id, is_collective);
 
     if (err < 0) {
@@ -125,6 +138,7 @@ inline herr_t h5p_set_coll_metadata_write(hid_t plist_id, hbool_t is_collective)
 }
 
 inline herr_t h5p_get_coll_metadata_write(hid_t plist_id, hbool_t* is_collective) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_coll_metadata_write(plist_id, is_collective);
 
     if (err < 0) {
@@ -137,6 +151,7 @@ inline herr_t h5p_get_coll_metadata_write(hid_t plist_id, hbool_t* is_collective
 #endif
 
 inline herr_t h5p_get_libver_bounds(hid_t plist_id, H5F_libver_t* low, H5F_libver_t* high) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_libver_bounds(plist_id, low, high);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Unable to access file version bounds");
@@ -146,6 +161,7 @@ inline herr_t h5p_get_libver_bounds(hid_t plist_id, H5F_libver_t* low, H5F_libve
 }
 
 inline herr_t h5p_set_libver_bounds(hid_t plist_id, H5F_libver_t low, H5F_libver_t high) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_libver_bounds(plist_id, low, high);
 
     if (err < 0) {
@@ -156,6 +172,7 @@ inline herr_t h5p_set_libver_bounds(hid_t plist_id, H5F_libver_t low, H5F_libver
 }
 
 inline herr_t h5p_get_meta_block_size(hid_t fapl_id, hsize_t* size) {
+    HIGHFIVE_INSTRUMENT(fapl_id);
     herr_t err = H5Pget_meta_block_size(fapl_id, size);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Unable to access file metadata block size");
@@ -165,6 +182,7 @@ inline herr_t h5p_get_meta_block_size(hid_t fapl_id, hsize_t* size) {
 }
 
 inline herr_t h5p_set_meta_block_size(hid_t fapl_id, hsize_t size) {
+    HIGHFIVE_INSTRUMENT(fapl_id);
     herr_t err = H5Pset_meta_block_size(fapl_id, size);
 
     if (err < 0) {
@@ -177,6 +195,7 @@ inline herr_t h5p_set_meta_block_size(hid_t fapl_id, hsize_t size) {
 inline herr_t h5p_set_est_link_info(hid_t plist_id,
                                     unsigned est_num_entries,
                                     unsigned est_name_len) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_est_link_info(plist_id, est_num_entries, est_name_len);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting estimated link info");
@@ -188,6 +207,7 @@ inline herr_t h5p_set_est_link_info(hid_t plist_id,
 inline herr_t h5p_get_est_link_info(hid_t plist_id,
                                     unsigned* est_num_entries,
                                     unsigned* est_name_len) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_est_link_info(plist_id, est_num_entries, est_name_len);
 
     if (err < 0) {
@@ -198,6 +218,7 @@ inline herr_t h5p_get_est_link_info(hid_t plist_id,
 }
 
 inline herr_t h5p_set_chunk(hid_t plist_id, int ndims, const hsize_t dim[]) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_chunk(plist_id, ndims, dim);
 
     if (err < 0) {
@@ -208,6 +229,7 @@ inline herr_t h5p_set_chunk(hid_t plist_id, int ndims, const hsize_t dim[]) {
 }
 
 inline int h5p_get_chunk(hid_t plist_id, int max_ndims, hsize_t dim[]) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     int chunk_dims = H5Pget_chunk(plist_id, max_ndims, dim);
     if (chunk_dims < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error getting chunk size");
@@ -215,7 +237,34 @@ inline int h5p_get_chunk(hid_t plist_id, int max_ndims, hsize_t dim[]) {
     return chunk_dims;
 }
 
+inline int h5p_get_nfilters(hid_t plist_id) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    int n_filters = H5Pget_nfilters(plist_id);
+    if (n_filters < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting number of filters");
+    }
+    return n_filters;
+}
+
+inline H5Z_filter_t h5p_get_filter2(hid_t plist_id,
+                                    unsigned idx,
+                                    unsigned* flags,
+                                    size_t* cd_nelmts,
+                                    unsigned cd_values[],
+                                    size_t namelen,
+                                    char name[],
+                                    unsigned* filter_config) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    H5Z_filter_t filter =
+        H5Pget_filter2(plist_id, idx, flags, cd_nelmts, cd_values, namelen, name, filter_config);
+    if (filter < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting filter");
+    }
+    return filter;
+}
+
 inline htri_t h5z_filter_avail(H5Z_filter_t id) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     htri_t tri = H5Zfilter_avail(id);
     if (tri < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error checking filter availability");
@@ -224,6 +273,7 @@ inline htri_t h5z_filter_avail(H5Z_filter_t id) {
 }
 
 inline herr_t h5p_set_deflate(hid_t plist_id, unsigned level) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_deflate(plist_id, level);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting deflate property");
@@ -232,6 +282,7 @@ inline herr_t h5p_set_deflate(hid_t plist_id, unsigned level) {
 }
 
 inline herr_t h5p_set_szip(hid_t plist_id, unsigned options_mask, unsigned pixels_per_block) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_szip(plist_id, options_mask, pixels_per_block);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting szip property");
@@ -240,6 +291,7 @@ inline herr_t h5p_set_szip(hid_t plist_id, unsigned options_mask, unsigned pixel
 }
 
 inline herr_t h5p_set_shuffle(hid_t plist_id) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_shuffle(plist_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting shuffle property");
@@ -248,6 +300,7 @@ inline herr_t h5p_set_shuffle(hid_t plist_id) {
 }
 
 inline herr_t h5p_get_alloc_time(hid_t plist_id, H5D_alloc_time_t* alloc_time) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_alloc_time(plist_id, alloc_time);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error getting allocation time");
@@ -256,6 +309,7 @@ inline herr_t h5p_get_alloc_time(hid_t plist_id, H5D_alloc_time_t* alloc_time) {
 }
 
 inline herr_t h5p_set_alloc_time(hid_t plist_id, H5D_alloc_time_t alloc_time) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_alloc_time(plist_id, alloc_time);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting allocation time");
@@ -263,10 +317,74 @@ inline herr_t h5p_set_alloc_time(hid_t plist_id, H5D_alloc_time_t alloc_time) {
     return err;
 }
 
+inline herr_t h5p_get_fill_time(hid_t plist_id, H5D_fill_time_t* fill_time) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pget_fill_time(plist_id, fill_time);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting fill time");
+    }
+    return err;
+}
+
+inline herr_t h5p_set_fill_time(hid_t plist_id, H5D_fill_time_t fill_time) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pset_fill_time(plist_id, fill_time);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting fill time");
+    }
+    return err;
+}
+
+inline H5D_layout_t h5p_get_layout(hid_t plist_id) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    H5D_layout_t layout = H5Pget_layout(plist_id);
+    if (layout < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting layout");
+    }
+    return layout;
+}
+
+inline herr_t h5p_fill_value_defined(hid_t plist_id, H5D_fill_value_t* status) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pfill_value_defined(plist_id, status);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error checking if fill value is defined");
+    }
+    return err;
+}
+
+inline herr_t h5p_get_fill_value(hid_t plist_id, hid_t type_id, void* value) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pget_fill_value(plist_id, type_id, value);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting fill value");
+    }
+    return err;
+}
+
+inline herr_t h5p_get_mdc_config(hid_t plist_id, H5AC_cache_config_t* config) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pget_mdc_config(plist_id, config);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting metadata cache config");
+    }
+    return err;
+}
+
+inline herr_t h5p_set_mdc_config(hid_t plist_id, const H5AC_cache_config_t* config) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pset_mdc_config(plist_id, const_cast<H5AC_cache_config_t*>(config));
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting metadata cache config");
+    }
+    return err;
+}
+
 inline herr_t h5p_get_chunk_cache(hid_t dapl_id,
                                   size_t* rdcc_nslots,
                                   size_t* rdcc_nbytes,
                                   double* rdcc_w0) {
+    HIGHFIVE_INSTRUMENT(dapl_id);
     herr_t err = H5Pget_chunk_cache(dapl_id, rdcc_nslots, rdcc_nbytes, rdcc_w0);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error getting dataset cache parameters");
@@ -278,6 +396,7 @@ inline herr_t h5p_set_chunk_cache(hid_t dapl_id,
                                   size_t rdcc_nslots,
                                   size_t rdcc_nbytes,
                                   double rdcc_w0) {
+    HIGHFIVE_INSTRUMENT(dapl_id);
     herr_t err = H5Pset_chunk_cache(dapl_id, rdcc_nslots, rdcc_nbytes, rdcc_w0);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting dataset cache parameters");
@@ -285,7 +404,81 @@ inline herr_t h5p_set_chunk_cache(hid_t dapl_id,
     return err;
 }
 
+inline herr_t h5p_set_buffer(hid_t plist_id, size_t size, void* tconv, void* bkg) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pset_buffer(plist_id, size, tconv, bkg);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting type conversion buffer");
+    }
+    return err;
+}
+
+inline size_t h5p_get_buffer(hid_t plist_id, void** tconv, void** bkg) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    size_t size = H5Pget_buffer(plist_id, tconv, bkg);
+    if (size == 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting type conversion buffer size");
+    }
+    return size;
+}
+
+inline herr_t h5p_get_hyper_vector_size(hid_t plist_id, size_t* size) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pget_hyper_vector_size(plist_id, size);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting hyperslab vector size");
+    }
+    return err;
+}
+
+inline herr_t h5p_set_hyper_vector_size(hid_t plist_id, size_t size) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pset_hyper_vector_size(plist_id, size);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting hyperslab vector size");
+    }
+    return err;
+}
+
+inline htri_t h5p_exist(hid_t plist_id, const char* name) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    htri_t exists = H5Pexist(plist_id, name);
+    if (exists < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error checking if property exists");
+    }
+    return exists;
+}
+
+inline herr_t h5p_insert2(hid_t plist_id, const char* name, size_t size, void* value) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pinsert2(
+        plist_id, name, size, value, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error inserting property");
+    }
+    return err;
+}
+
+inline herr_t h5p_get(hid_t plist_id, const char* name, void* value) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pget(plist_id, name, value);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting property");
+    }
+    return err;
+}
+
+inline herr_t h5p_set(hid_t plist_id, const char* name, const void* value) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pset(plist_id, name, const_cast<void*>(value));
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting property");
+    }
+    return err;
+}
+
 inline herr_t h5p_set_create_intermediate_group(hid_t plist_id, unsigned crt_intmd) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_create_intermediate_group(plist_id, crt_intmd);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>(
@@ -295,6 +488,7 @@ inline herr_t h5p_set_create_intermediate_group(hid_t plist_id, unsigned crt_int
 }
 
 inline herr_t h5p_get_create_intermediate_group(hid_t plist_id, unsigned* crt_intmd) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_create_intermediate_group(plist_id, crt_intmd);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>(
@@ -305,6 +499,7 @@ inline herr_t h5p_get_create_intermediate_group(hid_t plist_id, unsigned* crt_in
 
 #ifdef H5_HAVE_PARALLEL
 inline herr_t h5p_set_dxpl_mpio(hid_t dxpl_id, H5FD_mpio_xfer_t xfer_mode) {
+    HIGHFIVE_INSTRUMENT(dxpl_id);
     herr_t err = H5Pset_dxpl_mpio(dxpl_id, xfer_mode);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting H5Pset_dxpl_mpio.");
@@ -313,6 +508,7 @@ inline herr_t h5p_set_dxpl_mpio(hid_t dxpl_id, H5FD_mpio_xfer_t xfer_mode) {
 }
 
 inline herr_t h5p_get_dxpl_mpio(hid_t dxpl_id, H5FD_mpio_xfer_t* xfer_mode) {
+    HIGHFIVE_INSTRUMENT(dxpl_id);
     herr_t err = H5Pget_dxpl_mpio(dxpl_id, xfer_mode);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error getting H5Pset_dxpl_mpio.");
@@ -323,6 +519,7 @@ inline herr_t h5p_get_dxpl_mpio(hid_t dxpl_id, H5FD_mpio_xfer_t* xfer_mode) {
 inline herr_t h5p_get_mpio_no_collective_cause(hid_t plist_id,
                                                uint32_t* local_no_collective_cause,
                                                uint32_t* global_no_collective_cause) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_mpio_no_collective_cause(plist_id,
                                                  local_no_collective_cause,
                                                  global_no_collective_cause);
@@ -335,6 +532,7 @@ inline herr_t h5p_get_mpio_no_collective_cause(hid_t plist_id,
 #endif
 
 inline herr_t h5p_set_link_creation_order(hid_t plist_id, unsigned crt_order_flags) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_link_creation_order(plist_id, crt_order_flags);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>("Error setting LinkCreationOrder.");
@@ -343,6 +541,7 @@ inline herr_t h5p_set_link_creation_order(hid_t plist_id, unsigned crt_order_fla
 }
 
 inline herr_t h5p_get_link_creation_order(hid_t plist_id, unsigned* crt_order_flags) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_link_creation_order(plist_id, crt_order_flags);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>(
@@ -354,6 +553,7 @@ inline herr_t h5p_get_link_creation_order(hid_t plist_id, unsigned* crt_order_fl
 inline herr_t h5p_get_attr_phase_change(hid_t plist_id,
                                         unsigned* max_compact,
                                         unsigned* min_dense) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pget_attr_phase_change(plist_id, max_compact, min_dense);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>(
@@ -363,6 +563,7 @@ inline herr_t h5p_get_attr_phase_change(hid_t plist_id,
 }
 
 inline herr_t h5p_set_attr_phase_change(hid_t plist_id, unsigned max_compact, unsigned min_dense) {
+    HIGHFIVE_INSTRUMENT(plist_id);
     herr_t err = H5Pset_attr_phase_change(plist_id, max_compact, min_dense);
     if (err < 0) {
         HDF5ErrMapper::ToException<PropertyException>(
@@ -371,6 +572,34 @@ inline herr_t h5p_set_attr_phase_change(hid_t plist_id, unsigned max_compact, un
     return err;
 }
 
+inline herr_t h5p_set_vlen_mem_manager(hid_t plist_id,
+                                       H5MM_allocate_t alloc_func,
+                                       void* alloc_info,
+                                       H5MM_free_t free_func,
+                                       void* free_info) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pset_vlen_mem_manager(plist_id, alloc_func, alloc_info, free_func, free_info);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Error setting the variable length memory manager");
+    }
+    return err;
+}
+
+inline herr_t h5p_get_vlen_mem_manager(hid_t plist_id,
+                                       H5MM_allocate_t* alloc_func,
+                                       void** alloc_info,
+                                       H5MM_free_t* free_func,
+                                       void** free_info) {
+    HIGHFIVE_INSTRUMENT(plist_id);
+    herr_t err = H5Pget_vlen_mem_manager(plist_id, alloc_func, alloc_info, free_func, free_info);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>(
+            "Error getting the variable length memory manager");
+    }
+    return err;
+}
+
 
 }  // namespace detail
 }  // namespace HighFive
@@ -2,6 +2,8 @@
 
 #include <H5Rpublic.h>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 inline herr_t h5r_create(void* ref,
@@ -9,6 +11,7 @@ inline herr_t h5r_create(void* ref,
                          const char* name,
                          H5R_type_t ref_type,
                          hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     herr_t err = H5Rcreate(ref, loc_id, name, ref_type, space_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<ReferenceException>(
@@ -20,6 +23,7 @@ inline herr_t h5r_create(void* ref,
 
 #if (H5Rdereference_vers == 2)
 inline hid_t h5r_dereference(hid_t obj_id, hid_t oapl_id, H5R_type_t ref_type, const void* ref) {
+    HIGHFIVE_INSTRUMENT(obj_id);
     hid_t hid = H5Rdereference(obj_id, oapl_id, ref_type, ref);
     if (hid < 0) {
         HDF5ErrMapper::ToException<ReferenceException>("Unable to dereference.");
@@ -29,6 +33,7 @@ inline hid_t h5r_dereference(hid_t obj_id, hid_t oapl_id, H5R_type_t ref_type, c
 }
 #else
 inline hid_t h5r_dereference(hid_t dataset, H5R_type_t ref_type, const void* ref) {
+    HIGHFIVE_INSTRUMENT(dataset);
     hid_t hid = H5Rdereference(dataset, ref_type, ref);
     if (hid < 0) {
         HDF5ErrMapper::ToException<ReferenceException>("Unable to dereference.");
@@ -2,10 +2,14 @@
 
 #include <H5Ipublic.h>
 #include <H5Spublic.h>
+
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 
 inline hid_t h5s_create_simple(int rank, const hsize_t dims[], const hsize_t maxdims[]) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     hid_t space_id = H5Screate_simple(rank, dims, maxdims);
     if (space_id == H5I_INVALID_HID) {
         throw DataSpaceException("Unable to create simple dataspace");
@@ -15,6 +19,7 @@ inline hid_t h5s_create_simple(int rank, const hsize_t dims[], const hsize_t max
 }
 
 inline hid_t h5s_create(H5S_class_t type) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     hid_t space_id = H5Screate(type);
 
     if (space_id == H5I_INVALID_HID) {
@@ -25,6 +30,7 @@ inline hid_t h5s_create(H5S_class_t type) {
 }
 
 inline hid_t h5s_copy(hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(space_id);
     hid_t copy_id = H5Scopy(space_id);
 
     if (copy_id < 0) {
@@ -35,6 +41,7 @@ inline hid_t h5s_copy(hid_t space_id) {
 }
 
 inline herr_t h5s_select_none(hid_t spaceid) {
+    HIGHFIVE_INSTRUMENT(spaceid);
     herr_t err = H5Sselect_none(spaceid);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataSpaceException>("Unable to select None space");
@@ -48,6 +55,7 @@ inline herr_t h5s_select_hyperslab(hid_t space_id,
                                    const hsize_t stride[],
                                    const hsize_t count[],
                                    const hsize_t block[]) {
+    HIGHFIVE_INSTRUMENT(space_id);
     herr_t err = H5Sselect_hyperslab(space_id, op, start, stride, count, block);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataSpaceException>("Unable to select hyperslab");
@@ -56,6 +64,7 @@ inline herr_t h5s_select_hyperslab(hid_t space_id,
 }
 
 inline hssize_t h5s_get_select_npoints(hid_t spaceid) {
+    HIGHFIVE_INSTRUMENT(spaceid);
     hssize_t n_points = H5Sget_select_npoints(spaceid);
     if (n_points < 0) {
         HDF5ErrMapper::ToException<DataSpaceException>(
@@ -64,10 +73,20 @@ inline hssize_t h5s_get_select_npoints(hid_t spaceid) {
     return n_points;
 }
 
+inline herr_t h5s_get_select_bounds(hid_t space_id, hsize_t* start, hsize_t* end) {
+    HIGHFIVE_INSTRUMENT(space_id);
+    herr_t err = H5Sget_select_bounds(space_id, start, end);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to get bounds of selection");
+    }
+    return err;
+}
+
 inline herr_t h5s_select_elements(hid_t space_id,
                                   H5S_seloper_t op,
                                   size_t num_elem,
                                   const hsize_t* coord) {
+    HIGHFIVE_INSTRUMENT(space_id);
     herr_t err = H5Sselect_elements(space_id, op, num_elem, coord);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataSpaceException>("Unable to select elements");
@@ -76,6 +95,7 @@ inline herr_t h5s_select_elements(hid_t space_id,
 }
 
 inline int h5s_get_simple_extent_ndims(hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(space_id);
     int ndim = H5Sget_simple_extent_ndims(space_id);
     if (ndim < 0) {
         HDF5ErrMapper::ToException<DataSetException>(
@@ -85,6 +105,7 @@ inline int h5s_get_simple_extent_ndims(hid_t space_id) {
 }
 
 inline herr_t h5s_get_simple_extent_dims(hid_t space_id, hsize_t dims[], hsize_t maxdims[]) {
+    HIGHFIVE_INSTRUMENT(space_id);
     herr_t err = H5Sget_simple_extent_dims(space_id, dims, maxdims);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataSetException>("Unable to get dimensions of dataspace");
@@ -93,6 +114,7 @@ inline herr_t h5s_get_simple_extent_dims(hid_t space_id, hsize_t dims[], hsize_t
 }
 
 inline hssize_t h5s_get_simple_extent_npoints(hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(space_id);
     hssize_t nelements = H5Sget_simple_extent_npoints(space_id);
     if (nelements < 0) {
         HDF5ErrMapper::ToException<DataSetException>(
@@ -103,6 +125,7 @@ inline hssize_t h5s_get_simple_extent_npoints(hid_t space_id) {
 }
 
 inline H5S_class_t h5s_get_simple_extent_type(hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(space_id);
     H5S_class_t cls = H5Sget_simple_extent_type(space_id);
     if (cls == H5S_NO_CLASS) {
         HDF5ErrMapper::ToException<DataSpaceException>("Unable to get class of simple dataspace.");
@@ -112,6 +135,7 @@ inline H5S_class_t h5s_get_simple_extent_type(hid_t space_id) {
 }
 
 inline H5S_sel_type h5s_get_select_type(hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(space_id);
     H5S_sel_type type = H5Sget_select_type(space_id);
     if (type < 0) {
         HDF5ErrMapper::ToException<DataSpaceException>("Unable to get type of selection.");
@@ -120,8 +144,33 @@ inline H5S_sel_type h5s_get_select_type(hid_t space_id) {
     return type;
 }
 
+inline hssize_t h5s_get_select_hyper_nblocks(hid_t space_id) {
+    HIGHFIVE_INSTRUMENT(space_id);
+    hssize_t n_blocks = H5Sget_select_hyper_nblocks(space_id);
+    if (n_blocks < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>(
+            "Unable to get number of blocks in hyperslab selection.");
+    }
+
+    return n_blocks;
+}
+
+#if H5_VERSION_GE(1, 10, 7)
+inline htri_t h5s_select_intersect_block(hid_t space_id, const hsize_t* start, const hsize_t* end) {
+    HIGHFIVE_INSTRUMENT(space_id);
+    htri_t intersects = H5Sselect_intersect_block(space_id, start, end);
+    if (intersects < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>(
+            "Unable to intersect the selection with a block.");
+    }
+
+    return intersects;
+}
+#endif
+
 #if H5_VERSION_GE(1, 10, 6)
 inline hid_t h5s_combine_select(hid_t space1_id, H5S_seloper_t op, hid_t space2_id) {
+    HIGHFIVE_INSTRUMENT(space1_id);
     auto space_id = H5Scombine_select(space1_id, op, space2_id);
     if (space_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<DataSpaceException>("Unable to combine two selections.");
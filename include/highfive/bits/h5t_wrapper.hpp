@@ -3,10 +3,13 @@
 #include <H5Ipublic.h>
 #include <H5Tpublic.h>
 
+#include "H5Instrumentation.hpp"
+
 namespace HighFive {
 namespace detail {
 
 inline hid_t h5t_copy(hid_t original) {
+    HIGHFIVE_INSTRUMENT(original);
     auto copy = H5Tcopy(original);
     if (copy == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<DataTypeException>("Error copying datatype.");
@@ -16,6 +19,7 @@ inline hid_t h5t_copy(hid_t original) {
 }
 
 inline hsize_t h5t_get_size(hid_t hid) {
+    HIGHFIVE_INSTRUMENT(hid);
     hsize_t size = H5Tget_size(hid);
     if (size == 0) {
         HDF5ErrMapper::ToException<DataTypeException>("Error getting size of datatype.");
@@ -25,6 +29,7 @@ inline hsize_t h5t_get_size(hid_t hid) {
 }
 
 inline H5T_cset_t h5t_get_cset(hid_t hid) {
+    HIGHFIVE_INSTRUMENT(hid);
     auto cset = H5Tget_cset(hid);
     if (cset == H5T_CSET_ERROR) {
         HDF5ErrMapper::ToException<DataTypeException>("Error getting cset of datatype.");
@@ -33,7 +38,18 @@ inline H5T_cset_t h5t_get_cset(hid_t hid) {
     return cset;
 }
 
+inline H5T_sign_t h5t_get_sign(hid_t hid) {
+    HIGHFIVE_INSTRUMENT(hid);
+    H5T_sign_t sign = H5Tget_sign(hid);
+    if (sign == H5T_SGN_ERROR) {
+        HDF5ErrMapper::ToException<DataTypeException>("Unable to get the sign of the datatype.");
+    }
+
+    return sign;
+}
+
 inline H5T_str_t h5t_get_strpad(hid_t hid) {
+    HIGHFIVE_INSTRUMENT(hid);
     auto strpad = H5Tget_strpad(hid);
     if (strpad == H5T_STR_ERROR) {
         HDF5ErrMapper::ToException<DataTypeException>("Error getting strpad of datatype.");
@@ -43,24 +59,28 @@ inline H5T_str_t h5t_get_strpad(hid_t hid) {
 }
 
 inline void h5t_set_size(hid_t hid, hsize_t size) {
+    HIGHFIVE_INSTRUMENT(hid);
     if (H5Tset_size(hid, size) < 0) {
         HDF5ErrMapper::ToException<DataTypeException>("Error setting size of datatype.");
     }
 }
 
 inline void h5t_set_cset(hid_t hid, H5T_cset_t cset) {
+    HIGHFIVE_INSTRUMENT(hid);
     if (H5Tset_cset(hid, cset) < 0) {
         HDF5ErrMapper::ToException<DataTypeException>("Error setting cset of datatype.");
     }
 }
 
 inline void h5t_set_strpad(hid_t hid, H5T_str_t strpad) {
+    HIGHFIVE_INSTRUMENT(hid);
     if (H5Tset_strpad(hid, strpad) < 0) {
         HDF5ErrMapper::ToException<DataTypeException>("Error setting strpad of datatype.");
     }
 }
 
 inline int h5t_get_nmembers(hid_t hid) {
+    HIGHFIVE_INSTRUMENT(hid);
     auto result = H5Tget_nmembers(hid);
 
     if (result < 0) {
@@ -71,6 +91,7 @@ inline int h5t_get_nmembers(hid_t hid) {
 }
 
 inline char* h5t_get_member_name(hid_t type_id, unsigned membno) {
+    HIGHFIVE_INSTRUMENT(type_id);
     char* name = H5Tget_member_name(type_id, membno);
     if (name == nullptr) {
         throw DataTypeException("Failed to get member names of compound datatype");
@@ -81,12 +102,14 @@ inline char* h5t_get_member_name(hid_t type_id, unsigned membno) {
 
 
 inline size_t h5t_get_member_offset(hid_t type_id, unsigned membno) {
+    HIGHFIVE_INSTRUMENT(type_id);
     // Note, this function is peculiar. On failure it returns 0, yet 0 is also
     // what's returned on failure.
     return H5Tget_member_offset(type_id, membno);
 }
 
 inline hid_t h5t_get_member_type(hid_t type_id, unsigned membno) {
+    HIGHFIVE_INSTRUMENT(type_id);
     hid_t member_id = H5Tget_member_type(type_id, membno);
 
     if (member_id < 0) {
@@ -98,6 +121,7 @@ inline hid_t h5t_get_member_type(hid_t type_id, unsigned membno) {
 
 #if H5_VERSION_GE(1, 12, 0)
 inline herr_t h5t_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void* buf) {
+    HIGHFIVE_INSTRUMENT(type_id);
     herr_t err = H5Treclaim(type_id, space_id, plist_id, buf);
     if (err < 0) {
         throw DataTypeException("Failed to reclaim HDF5 internal memory");
@@ -108,6 +132,7 @@ inline herr_t h5t_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void* b
 #endif
 
 inline H5T_class_t h5t_get_class(hid_t type_id) {
+    HIGHFIVE_INSTRUMENT(type_id);
     H5T_class_t class_id = H5Tget_class(type_id);
     if (class_id == H5T_NO_CLASS) {
         throw DataTypeException("Failed to get class of type");
@@ -117,6 +142,7 @@ inline H5T_class_t h5t_get_class(hid_t type_id) {
 }
 
 inline htri_t h5t_equal(hid_t type1_id, hid_t type2_id) {
+    HIGHFIVE_INSTRUMENT(type1_id);
     htri_t equal = H5Tequal(type1_id, type2_id);
     if (equal < 0) {
         throw DataTypeException("Failed to compare two datatypes");
@@ -125,7 +151,60 @@ inline htri_t h5t_equal(hid_t type1_id, hid_t type2_id) {
     return equal;
 }
 
+inline H5T_conv_t h5t_find(hid_t src_id, hid_t dst_id, H5T_cdata_t** pcdata) {
+    HIGHFIVE_INSTRUMENT(src_id);
+    H5T_conv_t conv = H5Tfind(src_id, dst_id, pcdata);
+    if (conv == nullptr) {
+        HDF5ErrMapper::ToException<DataTypeException>(
+            "Unable to find a conversion path between the datatypes.");
+    }
+
+    return conv;
+}
+
+inline htri_t h5t_compiler_conv(hid_t src_id, hid_t dst_id) {
+    HIGHFIVE_INSTRUMENT(src_id);
+    htri_t is_compiler_conv = H5Tcompiler_conv(src_id, dst_id);
+    if (is_compiler_conv < 0) {
+        HDF5ErrMapper::ToException<DataTypeException>(
+            "Unable to check if the conversion path is a hard conversion.");
+    }
+
+    return is_compiler_conv;
+}
+
+inline herr_t h5t_register(H5T_pers_t pers,
+                           const char* name,
+                           hid_t src_id,
+                           hid_t dst_id,
+                           H5T_conv_t func) {
+    HIGHFIVE_INSTRUMENT(src_id);
+    herr_t err = H5Tregister(pers, name, src_id, dst_id, func);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataTypeException>(
+            std::string("Unable to register the conversion function '") + name + "'.");
+    }
+
+    return err;
+}
+
+inline herr_t h5t_unregister(H5T_pers_t pers,
+                             const char* name,
+                             hid_t src_id,
+                             hid_t dst_id,
+                             H5T_conv_t func) {
+    HIGHFIVE_INSTRUMENT(src_id);
+    herr_t err = H5Tunregister(pers, name, src_id, dst_id, func);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataTypeException>(
+            std::string("Unable to unregister the conversion function '") + name + "'.");
+    }
+
+    return err;
+}
+
 inline htri_t h5t_is_variable_str(hid_t type_id) {
+    HIGHFIVE_INSTRUMENT(type_id);
     htri_t is_variable = H5Tis_variable_str(type_id);
     if (is_variable < 0) {
         HDF5ErrMapper::ToException<DataTypeException>(
@@ -140,6 +219,7 @@ inline herr_t h5t_set_fields(hid_t type_id,
                              size_t esize,
                              size_t mpos,
                              size_t msize) {
+    HIGHFIVE_INSTRUMENT(type_id);
     herr_t err = H5Tset_fields(type_id, spos, epos, esize, mpos, msize);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataTypeException>(
@@ -149,6 +229,7 @@ inline herr_t h5t_set_fields(hid_t type_id,
 }
 
 inline herr_t h5t_set_ebias(hid_t type_id, size_t ebias) {
+    HIGHFIVE_INSTRUMENT(type_id);
     herr_t err = H5Tset_ebias(type_id, ebias);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataTypeException>(
@@ -159,6 +240,7 @@ inline herr_t h5t_set_ebias(hid_t type_id, size_t ebias) {
 }
 
 inline hid_t h5t_create(H5T_class_t type, size_t size) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
     hid_t type_id = H5Tcreate(type, size);
     if (type_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<DataTypeException>("Failed to datatype");
@@ -168,6 +250,7 @@ inline hid_t h5t_create(H5T_class_t type, size_t size) {
 }
 
 inline herr_t h5t_insert(hid_t parent_id, const char* name, size_t offset, hid_t member_id) {
+    HIGHFIVE_INSTRUMENT(parent_id);
     herr_t err = H5Tinsert(parent_id, name, offset, member_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataTypeException>("Failed to not add new member to datatype");
@@ -182,6 +265,7 @@ inline herr_t h5t_commit2(hid_t loc_id,
                           hid_t lcpl_id,
                           hid_t tcpl_id,
                           hid_t tapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     herr_t err = H5Tcommit2(loc_id, name, type_id, lcpl_id, tcpl_id, tapl_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataTypeException>("Failed to commit datatype");
@@ -191,6 +275,7 @@ inline herr_t h5t_commit2(hid_t loc_id,
 }
 
 inline herr_t h5t_close(hid_t type_id) {
+    HIGHFIVE_INSTRUMENT(type_id);
     auto err = H5Tclose(type_id);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataTypeException>("Failed to close datatype");
@@ -200,6 +285,7 @@ inline herr_t h5t_close(hid_t type_id) {
 }
 
 inline hid_t h5t_enum_create(hid_t base_id) {
+    HIGHFIVE_INSTRUMENT(base_id);
     hid_t type_id = H5Tenum_create(base_id);
     if (type_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<DataTypeException>("Failed to create new enum datatype");
@@ -208,6 +294,7 @@ inline hid_t h5t_enum_create(hid_t base_id) {
 }
 
 inline herr_t h5t_enum_insert(hid_t type, const char* name, const void* value) {
+    HIGHFIVE_INSTRUMENT(type);
     herr_t err = H5Tenum_insert(type, name, value);
     if (err < 0) {
         HDF5ErrMapper::ToException<DataTypeException>(
@@ -217,6 +304,7 @@ inline herr_t h5t_enum_insert(hid_t type, const char* name, const void* value) {
 }
 
 inline hid_t h5t_open2(hid_t loc_id, const char* name, hid_t tapl_id) {
+    HIGHFIVE_INSTRUMENT(loc_id);
     hid_t datatype_id = H5Topen2(loc_id, name, tapl_id);
     if (datatype_id == H5I_INVALID_HID) {
         HDF5ErrMapper::ToException<DataTypeException>(
@@ -226,5 +314,24 @@ inline hid_t h5t_open2(hid_t loc_id, const char* name, hid_t tapl_id) {
     return datatype_id;
 }
 
+inline herr_t h5t_encode(hid_t obj_id, void* buf, size_t* nalloc) {
+    HIGHFIVE_INSTRUMENT(obj_id);
+    herr_t err = H5Tencode(obj_id, buf, nalloc);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataTypeException>(std::string("Unable to encode datatype."));
+    }
+    return err;
+}
+
+inline hid_t h5t_decode(const void* buf) {
+    HIGHFIVE_INSTRUMENT(H5I_INVALID_HID);
+    hid_t datatype_id = H5Tdecode(buf);
+    if (datatype_id == H5I_INVALID_HID) {
+        HDF5ErrMapper::ToException<DataTypeException>(std::string("Unable to decode datatype."));
+    }
+
+    return datatype_id;
+}
+
 }  // namespace detail
 }  // namespace HighFive
@@ -0,0 +1,171 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "H5Simd.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// Bits are packed eight per byte, the first element in the least significant
+// bit. The unused bits of the last byte are zero.
+
+inline void pack_bits_scalar(const uint8_t* values, size_t n, uint8_t* bits) {
+    for (size_t i = 0; i < n; i += 8) {
+        uint8_t byte = 0;
+        for (size_t k = 0; k < std::min(size_t(8), n - i); ++k) {
+            byte = static_cast<uint8_t>(byte | (values[i + k] != 0 ? 1u : 0u) << k);
+        }
+        bits[i / 8] = byte;
+    }
+}
+
+inline void unpack_bits_scalar(const uint8_t* bits, size_t n, uint8_t* values) {
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = static_cast<uint8_t>((bits[i / 8] >> (i % 8)) & 1u);
+    }
+}
+
+#ifdef HIGHFIVE_SIMD_X86
+
+// The movemasks are little-endian, like x86.
+inline void pack_bits_sse2(const uint8_t* values, size_t n, uint8_t* bits) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        auto packed = static_cast<uint16_t>(~_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)));
+        std::memcpy(bits + i / 8, &packed, sizeof(packed));
+    }
+    pack_bits_scalar(values + i, n - i, bits + i / 8);
+}
+
+inline void unpack_bits_sse2(const uint8_t* bits, size_t n, uint8_t* values) {
+    const __m128i select =
+        _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i one = _mm_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        uint16_t packed;
+        std::memcpy(&packed, bits + i / 8, sizeof(packed));
+        // Repeat the first byte in the lower and the second in the upper half.
+        __m128i v = _mm_cvtsi32_si128(packed);
+        v = _mm_unpacklo_epi8(v, v);
+        v = _mm_unpacklo_epi16(v, v);
+        v = _mm_unpacklo_epi32(v, v);
+        v = _mm_and_si128(_mm_cmpeq_epi8(_mm_and_si128(v, select), select), one);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), v);
+    }
+    unpack_bits_scalar(bits + i / 8, n - i, values + i);
+}
+
+__attribute__((target("avx2"))) inline void pack_bits_avx2(const uint8_t* values,
+                                                          size_t n,
+                                                          uint8_t* bits) {
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        auto packed = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero)));
+        std::memcpy(bits + i / 8, &packed, sizeof(packed));
+    }
+    pack_bits_sse2(values + i, n - i, bits + i / 8);
+}
+
+__attribute__((target("avx2"))) inline void unpack_bits_avx2(const uint8_t* bits,
+                                                            size_t n,
+                                                            uint8_t* values) {
+    // Byte `k` of the result is a copy of byte `k / 8` of the packed bits.
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i select = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32,
+                                            64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8,
+                                            16, 32, 64, -128);
+    const __m256i one = _mm256_set1_epi8(1);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint32_t packed;
+        std::memcpy(&packed, bits + i / 8, sizeof(packed));
+        __m256i v = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(packed)), spread);
+        v = _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_and_si256(v, select), select), one);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), v);
+    }
+    unpack_bits_sse2(bits + i / 8, n - i, values + i);
+}
+
+#endif
+
+inline SimdLevel pack_bits_simd_level() {
+    static const SimdLevel level = get_supported_simd_level();
+    return level;
+}
+
+// Packs `n` values, one per byte, into bits. Non-zero values are `true`. Byte
+// operations on 512-bit registers require AVX-512BW, therefore AVX-512 hosts
+// use the AVX2 kernels.
+inline void pack_bits(const uint8_t* values, size_t n, uint8_t* bits) {
+#ifdef HIGHFIVE_SIMD_X86
+    if (pack_bits_simd_level() >= SimdLevel::AVX2) {
+        pack_bits_avx2(values, n, bits);
+    } else {
+        pack_bits_sse2(values, n, bits);
+    }
+#else
+    pack_bits_scalar(values, n, bits);
+#endif
+}
+
+// Unpacks `n` bits into bytes which are `0` or `1`.
+inline void unpack_bits(const uint8_t* bits, size_t n, uint8_t* values) {
+#ifdef HIGHFIVE_SIMD_X86
+    if (pack_bits_simd_level() >= SimdLevel::AVX2) {
+        unpack_bits_avx2(bits, n, values);
+    } else {
+        unpack_bits_sse2(bits, n, values);
+    }
+#else
+    unpack_bits_scalar(bits, n, values);
+#endif
+}
+
+// `std::vector<bool>` only exposes its bits one at a time. They're copied
+// through a buffer of bytes, which is packed or unpacked by the kernels above.
+constexpr size_t vector_bool_buffer_size = 4096;
+
+inline void vector_bool_to_bits(const std::vector<bool>& values, uint8_t* bits) {
+    uint8_t buffer[vector_bool_buffer_size];
+    auto it = values.begin();
+    for (size_t i = 0; i < values.size(); i += vector_bool_buffer_size) {
+        const size_t n = std::min(vector_bool_buffer_size, values.size() - i);
+        std::copy(it, it + static_cast<std::ptrdiff_t>(n), buffer);
+        it += static_cast<std::ptrdiff_t>(n);
+        pack_bits(buffer, n, bits + i / 8);
+    }
+}
+
+// `values` must already have the right size.
+inline void bits_to_vector_bool(const uint8_t* bits, std::vector<bool>& values) {
+    uint8_t buffer[vector_bool_buffer_size];
+    auto it = values.begin();
+    for (size_t i = 0; i < values.size(); i += vector_bool_buffer_size) {
+        const size_t n = std::min(vector_bool_buffer_size, values.size() - i);
+        unpack_bits(bits + i / 8, n, buffer);
+        it = std::transform(buffer, buffer + n, it, [](uint8_t b) { return b != 0; });
+    }
+}
+
+}  // namespace details
+}  // namespace HighFive
@@ -61,6 +61,19 @@ struct io_impl<T, typename std::enable_if<std::is_base_of<Eigen::DenseBase<T>, T
         throw detail::error(file, path, "H5Easy::load: Inconsistent rank");
     }
 
+    // Write `data` into an already opened DataSet or Attribute.
+    template <class D>
+    inline static void write(D& obj, const T& data) {
+        obj.reshapeMemSpace(mem_shape(data)).write(data);
+    }
+
+    // Read an already opened DataSet or Attribute.
+    template <class D>
+    inline static T read(const File& file, const std::string& path, const D& obj) {
+        std::vector<size_t> dims = mem_shape(file, path, obj.getSpace());
+        return obj.reshapeMemSpace(dims).template read<T>();
+    }
+
     inline static DataSet dump(File& file,
                                const std::string& path,
                                const T& data,
@@ -68,9 +81,8 @@ struct io_impl<T, typename std::enable_if<std::is_base_of<Eigen::DenseBase<T>, T
         using value_type = typename std::decay<T>::type::Scalar;
 
         std::vector<size_t> file_dims = file_shape(data);
-        std::vector<size_t> mem_dims = mem_shape(data);
         DataSet dataset = initDataset<value_type>(file, path, file_dims, options);
-        dataset.reshapeMemSpace(mem_dims).write(data);
+        write(dataset, data);
         if (options.flush()) {
             file.flush();
         }
@@ -78,9 +90,7 @@ struct io_impl<T, typename std::enable_if<std::is_base_of<Eigen::DenseBase<T>, T
     }
 
     inline static T load(const File& file, const std::string& path) {
-        DataSet dataset = file.getDataSet(path);
-        std::vector<size_t> dims = mem_shape(file, path, dataset);
-        return dataset.reshapeMemSpace(dims).template read<T>();
+        return read(file, path, file.getDataSet(path));
     }
 
     inline static Attribute dumpAttribute(File& file,
@@ -91,9 +101,8 @@ struct io_impl<T, typename std::enable_if<std::is_base_of<Eigen::DenseBase<T>, T
         using value_type = typename std::decay<T>::type::Scalar;
 
         std::vector<size_t> file_dims = file_shape(data);
-        std::vector<size_t> mem_dims = mem_shape(data);
         Attribute attribute = initAttribute<value_type>(file, path, key, file_dims, options);
-        attribute.reshapeMemSpace(mem_dims).write(data);
+        write(attribute, data);
         if (options.flush()) {
             file.flush();
         }
@@ -105,9 +114,7 @@ struct io_impl<T, typename std::enable_if<std::is_base_of<Eigen::DenseBase<T>, T
                                   const std::string& key) {
         DataSet dataset = file.getDataSet(path);
         Attribute attribute = dataset.getAttribute(key);
-        DataSpace dataspace = attribute.getSpace();
-        std::vector<size_t> dims = mem_shape(file, path, dataspace);
-        return attribute.reshapeMemSpace(dims).template read<T>();
+        return read(file, path, attribute);
     }
 };
 
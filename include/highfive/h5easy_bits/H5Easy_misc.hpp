@@ -38,6 +38,38 @@ inline Exception dump_error(File& file, const std::string& path) {
     }
 }
 
+// The shape needed to hold all `indices`.
+inline std::vector<size_t> batchShape(const File& file,
+                                      const std::string& path,
+                                      const std::vector<std::vector<size_t>>& indices) {
+    std::vector<size_t> shape(indices[0].size(), 0);
+    for (const auto& idx: indices) {
+        if (idx.size() != shape.size()) {
+            throw error(file, path, "H5Easy: All indices must have the same rank");
+        }
+        for (size_t i = 0; i < idx.size(); ++i) {
+            shape[i] = std::max(shape[i], idx[i] + 1);
+        }
+    }
+    return shape;
+}
+
+// Select the entries `indices` of a DataSet. A contiguous run of indices in a
+// one-dimensional DataSet is selected as a hyperslab, otherwise as points.
+inline HighFive::Selection selectBatch(const DataSet& dataset,
+                                       const std::vector<std::vector<size_t>>& indices) {
+    bool is_run = indices[0].size() == 1;
+    for (size_t i = 1; is_run && i < indices.size(); ++i) {
+        is_run = indices[i][0] == indices[0][0] + i;
+    }
+
+    if (is_run) {
+        return dataset.select(std::vector<size_t>{indices[0][0]},
+                              std::vector<size_t>{indices.size()});
+    }
+    return dataset.select(HighFive::ElementSet(indices));
+}
+
 // get a opened DataSet: nd-array
 template <class T>
 inline DataSet initDataset(File& file,
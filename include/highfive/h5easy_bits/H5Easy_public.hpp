@@ -40,6 +40,10 @@ inline void DumpOptions::set(const Compression& level) {
     m_compression_level = level.get();
 }
 
+inline void DumpOptions::set(Growth mode) {
+    m_geometric_growth = static_cast<bool>(mode);
+}
+
 template <class T, class... Args>
 inline void DumpOptions::set(T arg, Args... args) {
     set(arg);
@@ -67,6 +71,10 @@ inline bool DumpOptions::compress() const {
     return m_compression_level > 0;
 }
 
+inline bool DumpOptions::growGeometrically() const {
+    return m_geometric_growth;
+}
+
 inline unsigned DumpOptions::getCompressionLevel() const {
     return m_compression_level;
 }
@@ -139,6 +147,22 @@ inline T load(const File& file, const std::string& path, const std::vector<size_
     return detail::io_impl<T>::load_part(file, path, idx);
 }
 
+template <class T>
+inline DataSet dumpBatch(File& file,
+                         const std::string& path,
+                         const std::vector<T>& data,
+                         const std::vector<std::vector<size_t>>& indices,
+                         const DumpOptions& options) {
+    return detail::io_impl<T>::dump_extend(file, path, data, indices, options);
+}
+
+template <class T>
+inline std::vector<T> loadBatch(const File& file,
+                                const std::string& path,
+                                const std::vector<std::vector<size_t>>& indices) {
+    return detail::io_impl<T>::load_part(file, path, indices);
+}
+
 template <class T>
 inline T load(const File& file, const std::string& path) {
     return detail::io_impl<T>::load(file, path);
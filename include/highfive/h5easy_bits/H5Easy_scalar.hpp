@@ -22,53 +22,61 @@ Used e.g. for scalars.
 */
 template <typename T, typename = void>
 struct io_impl: public default_io_impl<T> {
-    inline static DataSet dump_extend(File& file,
+    // Open (or create) an extendible DataSet, such that it has at least `shape`.
+    inline static DataSet init_extend(File& file,
                                       const std::string& path,
-                                      const T& data,
-                                      const std::vector<size_t>& idx,
+                                      const std::vector<size_t>& shape,
                                       const DumpOptions& options) {
-        std::vector<size_t> ones(idx.size(), 1);
-
         if (file.exist(path)) {
             DataSet dataset = file.getDataSet(path);
             std::vector<size_t> dims = dataset.getDimensions();
-            std::vector<size_t> shape = dims;
-            if (dims.size() != idx.size()) {
+            std::vector<size_t> new_dims = dims;
+            if (dims.size() != shape.size()) {
                 throw detail::error(
                     file,
                     path,
                     "H5Easy::dump: Dimension of the index and the existing field do not match");
             }
             for (size_t i = 0; i < dims.size(); ++i) {
-                shape[i] = std::max(dims[i], idx[i] + 1);
+                if (shape[i] <= dims[i]) {
+                    continue;
+                }
+                new_dims[i] = options.growGeometrically() ? std::max(shape[i], 2 * dims[i])
+                                                          : shape[i];
             }
-            if (shape != dims) {
-                dataset.resize(shape);
-            }
-            dataset.select(idx, ones).write(data);
-            if (options.flush()) {
-                file.flush();
+            if (new_dims != dims) {
+                dataset.resize(new_dims);
             }
             return dataset;
         }
 
         const size_t unlim = DataSpace::UNLIMITED;
-        std::vector<size_t> unlim_shape(idx.size(), unlim);
-        std::vector<hsize_t> chunks(idx.size(), 10);
+        std::vector<size_t> unlim_shape(shape.size(), unlim);
+        std::vector<hsize_t> chunks(shape.size(), 10);
         if (options.isChunked()) {
             chunks = options.getChunkSize();
-            if (chunks.size() != idx.size()) {
+            if (chunks.size() != shape.size()) {
                 throw error(file, path, "H5Easy::dump: Incorrect dimension ChunkSize");
             }
         }
+        DataSpace dataspace = DataSpace(shape, unlim_shape);
+        DataSetCreateProps props;
+        props.add(Chunking(chunks));
+        return file.createDataSet(path, dataspace, AtomicType<T>(), props, {}, true);
+    }
+
+    inline static DataSet dump_extend(File& file,
+                                      const std::string& path,
+                                      const T& data,
+                                      const std::vector<size_t>& idx,
+                                      const DumpOptions& options) {
+        std::vector<size_t> ones(idx.size(), 1);
         std::vector<size_t> shape(idx.size());
         for (size_t i = 0; i < idx.size(); ++i) {
             shape[i] = idx[i] + 1;
         }
-        DataSpace dataspace = DataSpace(shape, unlim_shape);
-        DataSetCreateProps props;
-        props.add(Chunking(chunks));
-        DataSet dataset = file.createDataSet(path, dataspace, AtomicType<T>(), props, {}, true);
+
+        DataSet dataset = init_extend(file, path, shape, options);
         dataset.select(idx, ones).write(data);
         if (options.flush()) {
             file.flush();
@@ -76,12 +84,46 @@ struct io_impl: public default_io_impl<T> {
         return dataset;
     }
 
+    inline static DataSet dump_extend(File& file,
+                                      const std::string& path,
+                                      const std::vector<T>& data,
+                                      const std::vector<std::vector<size_t>>& indices,
+                                      const DumpOptions& options) {
+        if (data.size() != indices.size()) {
+            throw error(file, path, "H5Easy::dumpBatch: Number of values and indices differ");
+        }
+        if (indices.empty()) {
+            // The rank of a new DataSet can't be deduced.
+            if (!file.exist(path)) {
+                throw error(file, path, "H5Easy::dumpBatch: No indices for a new DataSet");
+            }
+            return file.getDataSet(path);
+        }
+
+        DataSet dataset = init_extend(file, path, batchShape(file, path, indices), options);
+        selectBatch(dataset, indices).write(data);
+        if (options.flush()) {
+            file.flush();
+        }
+        return dataset;
+    }
+
     inline static T load_part(const File& file,
                               const std::string& path,
                               const std::vector<size_t>& idx) {
         std::vector<size_t> ones(idx.size(), 1);
         return file.getDataSet(path).select(idx, ones).read<T>();
     }
+
+    inline static std::vector<T> load_part(const File& file,
+                                           const std::string& path,
+                                           const std::vector<std::vector<size_t>>& indices) {
+        DataSet dataset = file.getDataSet(path);
+        if (indices.empty()) {
+            return {};
+        }
+        return selectBatch(dataset, indices).template read<std::vector<T>>();
+    }
 };
 
 }  // namespace detail
@@ -0,0 +1,173 @@
+/*
+ *  Copyright (c), 2017, Adrien Devresse <adrien.devresse@epfl.ch>
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <functional>
+#include <numeric>
+
+#include "../H5Easy.hpp"
+#include "H5Easy_misc.hpp"
+#include "H5Easy_scalar.hpp"
+
+namespace H5Easy {
+
+inline Session::Session(const File& file)
+    : m_file(file) {}
+
+inline File& Session::getFile() {
+    return m_file;
+}
+
+inline std::string Session::normalize(const std::string& path) {
+    if (!path.empty() && path[0] == '/') {
+        return path;
+    }
+    return "/" + path;
+}
+
+inline Session::CachedDataSet& Session::getCached(const std::string& path) {
+    auto key = normalize(path);
+    auto it = m_cache.find(key);
+    if (it == m_cache.end()) {
+        DataSet dataset = m_file.getDataSet(path);
+        auto shape = dataset.getDimensions();
+        it = m_cache.emplace(key, CachedDataSet{std::move(dataset), std::move(shape), {}}).first;
+    }
+    return it->second;
+}
+
+template <class T>
+inline DataSet Session::dump(const std::string& path, const T& data, DumpMode mode) {
+    return dump(path, data, DumpOptions(mode));
+}
+
+template <class T>
+inline DataSet Session::dump(const std::string& path, const T& data, const DumpOptions& options) {
+    auto key = normalize(path);
+    auto it = m_cache.find(key);
+    if (it == m_cache.end()) {
+        DataSet dataset = detail::io_impl<T>::dump(m_file, path, data, options);
+        m_cache.emplace(key, CachedDataSet{dataset, detail::io_impl<T>::file_shape(data), {}});
+        return dataset;
+    }
+
+    auto& cached = it->second;
+    if (!options.overwrite()) {
+        throw detail::dump_error(m_file, path);
+    }
+    if (cached.shape != detail::io_impl<T>::file_shape(data)) {
+        throw detail::error(m_file, path, "H5Easy::dump: Inconsistent dimensions");
+    }
+
+    detail::io_impl<T>::write(cached.dataset, data);
+    if (options.flush()) {
+        m_file.flush();
+    }
+    return cached.dataset;
+}
+
+template <class T>
+inline T Session::load(const std::string& path) {
+    return detail::io_impl<T>::read(m_file, path, getCached(path).dataset);
+}
+
+template <class T>
+inline Attribute Session::dumpAttribute(const std::string& path,
+                                        const std::string& key,
+                                        const T& data,
+                                        DumpMode mode) {
+    return dumpAttribute(path, key, data, DumpOptions(mode));
+}
+
+template <class T>
+inline Attribute Session::dumpAttribute(const std::string& path,
+                                        const std::string& key,
+                                        const T& data,
+                                        const DumpOptions& options) {
+    auto it = m_cache.find(normalize(path));
+    if (it == m_cache.end() || it->second.attributes.count(key) == 0) {
+        Attribute attribute = detail::io_impl<T>::dumpAttribute(m_file, path, key, data, options);
+        getCached(path).attributes.emplace(
+            key, CachedAttribute{attribute, detail::io_impl<T>::file_shape(data)});
+        return attribute;
+    }
+
+    auto& cached = it->second.attributes.find(key)->second;
+    if (!options.overwrite()) {
+        throw detail::error(m_file,
+                            path,
+                            "H5Easy: Attribute exists, overwrite with H5Easy::DumpMode::Overwrite.");
+    }
+    if (cached.shape != detail::io_impl<T>::file_shape(data)) {
+        throw detail::error(m_file, path, "H5Easy::dumpAttribute: Inconsistent dimensions");
+    }
+
+    detail::io_impl<T>::write(cached.attribute, data);
+    if (options.flush()) {
+        m_file.flush();
+    }
+    return cached.attribute;
+}
+
+template <class T>
+inline T Session::loadAttribute(const std::string& path, const std::string& key) {
+    auto& cached = getCached(path);
+    auto& attributes = cached.attributes;
+    auto it = attributes.find(key);
+    if (it == attributes.end()) {
+        Attribute attribute = cached.dataset.getAttribute(key);
+        auto shape = attribute.getSpace().getDimensions();
+        it = attributes.emplace(key, CachedAttribute{std::move(attribute), std::move(shape)}).first;
+    }
+    return detail::io_impl<T>::read(m_file, path, it->second.attribute);
+}
+
+inline std::vector<size_t> Session::getShape(const std::string& path) {
+    return getCached(path).shape;
+}
+
+inline size_t Session::getSize(const std::string& path) {
+    auto shape = getShape(path);
+    return std::accumulate(shape.begin(), shape.end(), size_t(1), std::multiplies<size_t>());
+}
+
+inline void Session::unlink(const std::string& path) {
+    invalidate(path);
+    m_file.unlink(path);
+}
+
+inline bool Session::rename(const std::string& src_path, const std::string& dest_path) {
+    invalidate(src_path);
+    invalidate(dest_path);
+    return m_file.rename(src_path, dest_path);
+}
+
+inline void Session::invalidate(const std::string& path) {
+    auto key = normalize(path);
+    if (key == "/") {
+        clear();
+        return;
+    }
+
+    // Drop `key` itself and all paths of the form `key + "/..."`.
+    auto it = m_cache.lower_bound(key);
+    while (it != m_cache.end() && it->first.compare(0, key.size(), key) == 0) {
+        if (it->first.size() == key.size() || it->first[key.size()] == '/') {
+            it = m_cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+inline void Session::clear() {
+    m_cache.clear();
+}
+
+}  // namespace H5Easy
@@ -19,17 +19,29 @@ using HighFive::details::inspector;
 
 template <typename T>
 struct default_io_impl {
-    inline static std::vector<size_t> shape(const T& data) {
+    inline static std::vector<size_t> file_shape(const T& data) {
         return inspector<T>::getDimensions(data);
     }
 
+    // Write `data` into an already opened DataSet or Attribute.
+    template <class D>
+    inline static void write(D& obj, const T& data) {
+        obj.write(data);
+    }
+
+    // Read an already opened DataSet or Attribute.
+    template <class D>
+    inline static T read(const File& /* file */, const std::string& /* path */, const D& obj) {
+        return obj.template read<T>();
+    }
+
     inline static DataSet dump(File& file,
                                const std::string& path,
                                const T& data,
                                const DumpOptions& options) {
         using value_type = typename inspector<T>::base_type;
-        DataSet dataset = initDataset<value_type>(file, path, shape(data), options);
-        dataset.write(data);
+        DataSet dataset = initDataset<value_type>(file, path, file_shape(data), options);
+        write(dataset, data);
         if (options.flush()) {
             file.flush();
         }
@@ -37,7 +49,7 @@ struct default_io_impl {
     }
 
     inline static T load(const File& file, const std::string& path) {
-        return file.getDataSet(path).read<T>();
+        return read(file, path, file.getDataSet(path));
     }
 
     inline static Attribute dumpAttribute(File& file,
@@ -46,8 +58,8 @@ struct default_io_impl {
                                           const T& data,
                                           const DumpOptions& options) {
         using value_type = typename inspector<T>::base_type;
-        Attribute attribute = initAttribute<value_type>(file, path, key, shape(data), options);
-        attribute.write(data);
+        Attribute attribute = initAttribute<value_type>(file, path, key, file_shape(data), options);
+        write(attribute, data);
         if (options.flush()) {
             file.flush();
         }
@@ -59,7 +71,7 @@ struct default_io_impl {
                                   const std::string& key) {
         DataSet dataset = file.getDataSet(path);
         Attribute attribute = dataset.getAttribute(key);
-        return attribute.read<T>();
+        return read(file, path, attribute);
     }
 };
 
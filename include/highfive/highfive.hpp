@@ -1,6 +1,7 @@
 #pragma once
 
 #include <highfive/H5Attribute.hpp>
+#include <highfive/H5ChromeTrace.hpp>
 #include <highfive/H5DataSet.hpp>
 #include <highfive/H5DataSpace.hpp>
 #include <highfive/H5DataType.hpp>
@@ -9,5 +10,8 @@
 #include <highfive/H5PropertyList.hpp>
 #include <highfive/H5Reference.hpp>
 #include <highfive/H5Selection.hpp>
+#include <highfive/H5StorageAudit.hpp>
+#include <highfive/H5StringColumn.hpp>
+#include <highfive/H5StructureIndex.hpp>
 #include <highfive/H5Utility.hpp>
 #include <highfive/H5Version.hpp>
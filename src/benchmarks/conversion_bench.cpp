@@ -0,0 +1,91 @@
+#include <highfive/highfive.hpp>
+#include <highfive/H5FastConversion.hpp>
+#include <highfive/bfloat16.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Compares HDF5's built-in conversions with the ones registered by
+// `register_fast_conversions`, for each SIMD level the CPU supports.
+
+const size_t n_elements = 16 * 1024 * 1024;
+const int n_repetitions = 5;
+
+class BigEndianFloat: public HighFive::DataType {
+  public:
+    BigEndianFloat() {
+        _hid = H5Tcopy(H5T_IEEE_F32BE);
+    }
+};
+
+class Float16: public HighFive::DataType {
+  public:
+    Float16() {
+        _hid = HighFive::details::create_float16_datatype();
+    }
+};
+
+template <class T>
+double time_read(const HighFive::DataSet& dataset) {
+    std::vector<T> values;
+    dataset.read(values);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n_repetitions; ++i) {
+        dataset.read(values);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / n_repetitions;
+}
+
+void run(const HighFive::File& file, const char* label) {
+    auto report = [label](const char* conversion, double seconds) {
+        double gb_per_s = double(n_elements * sizeof(double)) / seconds * 1e-9;
+        std::printf(
+            "%-10s %-22s %8.2f ms %8.2f GB/s\n", label, conversion, seconds * 1e3, gb_per_s);
+    };
+
+    report("int16 -> double", time_read<double>(file.getDataSet("int16")));
+    report("int32 -> double", time_read<double>(file.getDataSet("int32")));
+    report("float -> double", time_read<double>(file.getDataSet("float")));
+    report("double -> float", time_read<float>(file.getDataSet("double")));
+    report("float BE -> double", time_read<double>(file.getDataSet("float_be")));
+    report("float BE -> float", time_read<float>(file.getDataSet("float_be")));
+    report("half -> float", time_read<float>(file.getDataSet("half")));
+    report("bfloat16 -> float", time_read<float>(file.getDataSet("bfloat16")));
+}
+
+int main() {
+    using namespace HighFive;
+    // The conversions are intended, don't warn about them.
+    register_logging_callback([](LogSeverity, const std::string&, const std::string&, int) {});
+
+    File file("conversion_bench.h5", File::Truncate);
+
+    std::vector<double> values(n_elements);
+    for (size_t i = 0; i < n_elements; ++i) {
+        values[i] = double(i % 30000) - 15000.0;
+    }
+
+    DataSpace space({n_elements});
+    file.createDataSet("int16", space, create_datatype<int16_t>()).write(values);
+    file.createDataSet("int32", space, create_datatype<int32_t>()).write(values);
+    file.createDataSet("float", space, create_datatype<float>()).write(values);
+    file.createDataSet("double", space, create_datatype<double>()).write(values);
+    file.createDataSet("float_be", space, BigEndianFloat()).write(values);
+    file.createDataSet("half", space, Float16()).write(values);
+    file.createDataSet("bfloat16", space, create_datatype<bfloat16_t>()).write(values);
+
+    run(file, "built-in");
+
+    const char* names[] = {"scalar", "sse2", "avx2", "avx512"};
+    for (auto level: {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level <= get_supported_simd_level()) {
+            register_fast_conversions(level);
+            run(file, names[static_cast<int>(level)]);
+        }
+    }
+}
@@ -1,7 +1,7 @@
 #!/bin/sh
 set -eu
 
-executables="hdf5_bench hdf5_bench_improved highfive_bench"
+executables="hdf5_bench hdf5_bench_improved highfive_bench conversion_bench"
 
 # Compile all
 make
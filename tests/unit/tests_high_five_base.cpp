@@ -8,15 +8,22 @@
  */
 #include <H5Ipublic.h>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <random>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <typeinfo>
 #include <type_traits>
 #include <vector>
@@ -26,6 +33,8 @@
 #include <catch2/matchers/catch_matchers_vector.hpp>
 
 #include <highfive/highfive.hpp>
+#include <highfive/H5PackedBits.hpp>
+#include <highfive/H5StringTable.hpp>
 #include "tests_high_five.hpp"
 #include "create_traits.hpp"
 
@@ -295,12 +304,65 @@ TEST_CASE("Test page buffer size") {
         CHECK(bypasses[0] == 0);
         CHECK(bypasses[1] == 0);
 
+        auto stats = file.getPageBufferStatistics();
+        CHECK(stats.metadata.accesses == accesses[0]);
+        CHECK(stats.raw_data.accesses == 1);
+        CHECK(stats.raw_data.getHitRate() <= 1.0);
+
+        file.resetPageBufferStatistics();
+        CHECK(file.getPageBufferStatistics().metadata.accesses == 0);
+
         CHECK(file.getFileSpacePageSize() == page_size);
     }
 }
 #endif
 #endif
 
+TEST_CASE("Test metadata cache statistics") {
+    const std::string file_name("h5_metadata_cache.h5");
+
+    FileAccessProps access_props;
+    access_props.add(MetadataCacheConfig(1 << 20, 1 << 19, 1 << 23));
+    CHECK(MetadataCacheConfig(access_props).getInitialSize() == 1 << 20);
+    CHECK(MetadataCacheConfig(access_props).getMaxSize() == 1 << 23);
+
+    File file(file_name, File::Truncate, access_props);
+    for (int i = 0; i < 20; ++i) {
+        file.createDataSet("group/dset" + std::to_string(i), std::vector<int>{i});
+    }
+
+    auto config = file.getMetadataCacheConfig();
+    CHECK(config.getMinSize() == 1 << 19);
+    CHECK(config.getMaxSize() == 1 << 23);
+
+    auto size = file.getMetadataCacheSize();
+    CHECK(size.max_size >= size.current_size);
+    CHECK(size.n_entries > 0);
+
+    file.resetMetadataCacheHitRate();
+    for (int i = 0; i < 20; ++i) {
+        file.getDataSet("group/dset" + std::to_string(i)).getDimensions();
+    }
+    auto hit_rate = file.getMetadataCacheHitRate();
+    CHECK(hit_rate > 0.0);
+    CHECK(hit_rate <= 1.0);
+
+    file.setMetadataCacheConfig(MetadataCacheConfig(1 << 21, 1 << 20, 1 << 22));
+    CHECK(file.getMetadataCacheConfig().getMaxSize() == 1 << 22);
+    CHECK(file.getMetadataCacheSize().max_size == 1 << 21);
+
+    DataSetCreateProps dcpl;
+    dcpl.add(Chunking(std::vector<hsize_t>{4}));
+    file.createDataSet("chunked", DataSpace({16}), create_datatype<int>(), dcpl);
+
+    DataSetAccessProps dapl;
+    dapl.add(Caching(13, 1 << 16, 0.5));
+    auto dataset = file.getDataSet("chunked", dapl);
+    CHECK(dataset.getChunkCache().getNumSlots() == 13);
+    CHECK(dataset.getChunkCache().getCacheSize() == 1 << 16);
+    CHECK(dataset.getChunkCache().getW0() == 0.5);
+}
+
 TEST_CASE("Test metadata block size assignment") {
     const std::string file_name("h5_meta_block_size.h5");
 
@@ -357,6 +419,307 @@ TEST_CASE("Test allocation time") {
     CHECK(alloc_size == data.size() * sizeof(decltype(data)::value_type));
 }
 
+TEST_CASE("Test fill time") {
+    const std::string file_name("h5_dataset_fill_time.h5");
+    File file(file_name, File::Truncate);
+
+    auto dcpl = DataSetCreateProps{};
+    dcpl.add(AllocationTime(H5D_ALLOC_TIME_EARLY));
+    dcpl.add(FillTime(H5D_FILL_TIME_NEVER));
+
+    auto dataset = file.createDataSet("dset", DataSpace({10}), create_datatype<double>(), dcpl);
+    CHECK(FillTime(dataset.getCreatePropertyList()).getFillTime() == H5D_FILL_TIME_NEVER);
+}
+
+TEST_CASE("Test fill selection") {
+    const std::string file_name("h5_dataset_fill.h5");
+    File file(file_name, File::Truncate);
+
+    SECTION("chunked") {
+        auto dcpl = DataSetCreateProps{};
+        dcpl.add(Chunking(std::vector<hsize_t>{4, 3}));
+        auto dataset = file.createDataSet("dset", DataSpace({10, 7}), create_datatype<int>(), dcpl);
+
+        dataset.fill(1);
+        dataset.select({1, 2}, {6, 4}).fill(2.0);
+        dataset.select(ElementSet({0, 0, 9, 6})).fill(3);
+
+        auto values = dataset.read<std::vector<std::vector<int>>>();
+        for (size_t i = 0; i < 10; ++i) {
+            for (size_t j = 0; j < 7; ++j) {
+                int expected = (i >= 1 && i < 7 && j >= 2 && j < 6) ? 2 : 1;
+                if ((i == 0 && j == 0) || (i == 9 && j == 6)) {
+                    expected = 3;
+                }
+                CHECK(values[i][j] == expected);
+            }
+        }
+    }
+
+    SECTION("small chunks") {
+        // Adjacent chunks are written together, up to 1 MiB at a time.
+        auto dcpl = DataSetCreateProps{};
+        dcpl.add(Chunking(std::vector<hsize_t>{1}));
+        auto dataset = file.createDataSet("dset", DataSpace({3000}), create_datatype<int>(), dcpl);
+
+        auto block = details::compute_fill_block(dcpl, {300000}, sizeof(int));
+        CHECK(block == std::vector<hsize_t>{262144});
+        CHECK(details::compute_fill_block(dcpl, {3000}, sizeof(int)) ==
+              std::vector<hsize_t>{3000});
+
+        dataset.fill(4);
+        dataset.select({7}, {2990}).fill(5);
+        auto values = dataset.read<std::vector<int>>();
+        CHECK(std::count(values.begin(), values.end(), 4) == 10);
+        CHECK(values[6] == 4);
+        CHECK(values[7] == 5);
+        CHECK(values[2996] == 5);
+        CHECK(values[2997] == 4);
+
+        auto dcpl_2d = DataSetCreateProps{};
+        dcpl_2d.add(Chunking(std::vector<hsize_t>{4, 3}));
+        CHECK(details::compute_fill_block(dcpl_2d, {10, 7}, sizeof(int)) ==
+              std::vector<hsize_t>{12, 9});
+        CHECK(details::compute_fill_block(dcpl_2d, {1000000, 7}, sizeof(int)) ==
+              std::vector<hsize_t>{29124, 9});
+    }
+
+    SECTION("contiguous") {
+        // Large enough to require writing multiple slabs.
+        size_t n_rows = 1000;
+        size_t n_cols = 300;
+        auto dataset = file.createDataSet("dset",
+                                          DataSpace({n_rows, n_cols}),
+                                          create_datatype<double>());
+
+        dataset.fill(0.5);
+        dataset.select(std::vector<size_t>{1}).fill(-1.0);
+
+        auto values = dataset.read<std::vector<std::vector<double>>>();
+        for (size_t i = 0; i < n_rows; ++i) {
+            CHECK(values[i][0] == 0.5);
+            CHECK(values[i][1] == -1.0);
+            CHECK(values[i][n_cols - 1] == 0.5);
+        }
+    }
+}
+
+#if H5_VERSION_GE(1, 10, 5)
+TEST_CASE("Test sparse read of chunked dataset") {
+    const std::string file_name("h5_dataset_sparse_read.h5");
+    File file(file_name, File::Truncate);
+
+    const int fill_value = -7;
+    auto dcpl = DataSetCreateProps{};
+    dcpl.add(Chunking(std::vector<hsize_t>{4, 3}));
+    H5Pset_fill_value(dcpl.getId(), H5T_NATIVE_INT, &fill_value);
+
+    auto dataset = file.createDataSet("dset", DataSpace({10, 7}), create_datatype<int>(), dcpl);
+    CHECK(dataset.getNumberAllocatedChunks() == 0);
+    CHECK(dataset.readSparse<std::vector<std::vector<int>>>() ==
+          std::vector<std::vector<int>>(10, std::vector<int>(7, fill_value)));
+
+    // Touches the chunks at {0, 3} and {8, 6}, the latter is clipped.
+    dataset.select({1, 4}, {2, 2}).write(std::vector<std::vector<int>>{{1, 2}, {3, 4}});
+    dataset.select({9, 6}, {1, 1}).write(std::vector<std::vector<int>>{{5}});
+
+    auto chunks = dataset.listAllocatedChunks();
+    REQUIRE(chunks.size() == 2);
+    REQUIRE(dataset.getNumberAllocatedChunks() == 2);
+    std::sort(chunks.begin(), chunks.end(), [](const ChunkInfo& a, const ChunkInfo& b) {
+        return a.offset < b.offset;
+    });
+    CHECK(chunks[0].offset == std::vector<size_t>{0, 3});
+    CHECK(chunks[1].offset == std::vector<size_t>{8, 6});
+    CHECK(chunks[0].size == 4 * 3 * sizeof(int));
+
+    auto region = dataset.getAllocatedRegion();
+    auto n_allocated = detail::h5s_get_select_npoints(region.apply(dataset.getSpace()).getId());
+    CHECK(n_allocated == 4 * 3 + 2 * 1);
+
+    auto expected = dataset.read<std::vector<std::vector<int>>>();
+    CHECK(expected[0][0] == fill_value);
+    CHECK(expected[2][5] == 4);
+    CHECK(dataset.readSparse<std::vector<std::vector<int>>>() == expected);
+
+    std::vector<std::vector<double>> as_double;
+    dataset.readSparse(as_double);
+    REQUIRE(as_double.size() == 10);
+    CHECK(as_double[0][0] == double(fill_value));
+    CHECK(as_double[9][6] == 5.0);
+
+    // Contiguous datasets fall back to a regular read.
+    auto contiguous = file.createDataSet("contiguous", std::vector<int>{1, 2, 3});
+    CHECK(contiguous.readSparse<std::vector<int>>() == std::vector<int>{1, 2, 3});
+
+    // Adjacent chunks are merged.
+    dataset.select({0, 0}, {1, 7}).write(std::vector<std::vector<int>>{std::vector<int>(7, 6)});
+    region = dataset.getAllocatedRegion();
+    n_allocated = detail::h5s_get_select_npoints(region.apply(dataset.getSpace()).getId());
+    CHECK(n_allocated == 4 * 7 + 2 * 1);
+    CHECK(dataset.readSparse<std::vector<std::vector<int>>>() ==
+          dataset.read<std::vector<std::vector<int>>>());
+}
+
+TEST_CASE("Test sparse read of a dataset with many chunks") {
+    const std::string file_name("h5_dataset_sparse_many_chunks.h5");
+    File file(file_name, File::Truncate);
+
+    auto dcpl = DataSetCreateProps{};
+    dcpl.add(Chunking(std::vector<hsize_t>{1}));
+    auto dataset = file.createDataSet("dset", DataSpace({10000}), create_datatype<int>(), dcpl);
+
+    std::vector<int> values(5000);
+    std::iota(values.begin(), values.end(), 1);
+    dataset.select({0}, {values.size()}).write(values);
+    REQUIRE(dataset.getNumberAllocatedChunks() == values.size());
+
+    // Without `H5Dchunk_iter`, so many chunks aren't listed.
+    auto region = dataset.getAllocatedRegion();
+    auto n_allocated = detail::h5s_get_select_npoints(region.apply(dataset.getSpace()).getId());
+#if HIGHFIVE_HAS_CHUNK_ITER
+    CHECK(n_allocated == 5000);
+#else
+    CHECK(n_allocated == 10000);
+#endif
+
+    // Only the chunks of the selection are looked up.
+    auto report = dataset.select({0}, {10}).explain<std::vector<int>>();
+    CHECK(report.is_chunk_count_exact);
+    CHECK(report.n_chunks == 10);
+    CHECK(report.chunk_bytes == 10 * sizeof(int));
+
+    report = dataset.select({4990}, {20}).explain<std::vector<int>>();
+    CHECK(report.is_chunk_count_exact);
+    CHECK(report.n_chunks == 10);
+
+    // Elements 0, 4000 and 8000, the last chunk isn't allocated.
+    auto strided = HyperSlab(RegularHyperSlab({0}, {3}, {4000}));
+    report = dataset.select(strided).explain<std::vector<int>>();
+    CHECK(report.is_chunk_count_exact);
+    CHECK(report.n_chunks == 2);
+
+    auto array = dataset.readSparse<std::vector<int>>();
+    CHECK(std::equal(values.begin(), values.end(), array.begin()));
+    CHECK(array.back() == 0);
+}
+
+TEST_CASE("Test transfer buffer properties") {
+    const std::string file_name("h5_transfer_buffers.h5");
+    File file(file_name, File::Truncate);
+
+    std::vector<char> conversion(1 << 12);
+    DataTransferProps dxpl;
+    dxpl.add(TypeConversionBuffer(conversion.size(), conversion.data()));
+    dxpl.add(HyperslabVectorSize(4096));
+    CHECK(TypeConversionBuffer(dxpl).getSize() == conversion.size());
+    CHECK(TypeConversionBuffer(dxpl).getConversionBuffer() == conversion.data());
+    CHECK(TypeConversionBuffer(dxpl).getBackgroundBuffer() == nullptr);
+    CHECK(HyperslabVectorSize(dxpl).getSize() == 4096);
+    CHECK(!AutoTransferBuffers(dxpl).isEnabled());
+
+    // The caller provided buffer is smaller than the selection.
+    std::vector<double> values(2000);
+    std::iota(values.begin(), values.end(), 0.0);
+    auto dataset = file.createDataSet<int>("dset", DataSpace::From(values));
+    dataset.write(values, dxpl);
+    CHECK(dataset.read<std::vector<double>>(dxpl) == values);
+
+    DataTransferProps automatic;
+    automatic.add(AutoTransferBuffers());
+    CHECK(AutoTransferBuffers(automatic).getMaxBufferSize() == 64 * 1024 * 1024);
+
+    // Auto sizing doesn't change the properties of the caller.
+    auto strided = dataset.select({0}, {500}, {4});
+    CHECK(strided.read<std::vector<double>>(automatic) ==
+          strided.read<std::vector<double>>());
+    CHECK(TypeConversionBuffer(automatic).getSize() == 1024 * 1024);
+    CHECK(HyperslabVectorSize(automatic).getSize() == 1024);
+
+    std::vector<double> halves(500, 0.5);
+    strided.write(halves, automatic);
+    CHECK(strided.read<std::vector<int>>(automatic) == std::vector<int>(500, 0));
+
+    automatic.add(AutoTransferBuffers(0));
+    CHECK(!AutoTransferBuffers(automatic).isEnabled());
+
+    // The properties passed to HDF5 fit a large strided selection.
+    auto large = file.createDataSet<int>("large", DataSpace({300000}));
+    auto selection = large.select({0}, {150000}, {2});
+    auto explain = [&selection](const DataTransferProps& props) {
+        return selection.explain<std::vector<double>>(TransferDirection::Read, props);
+    };
+
+    auto report = explain(DataTransferProps());
+    CHECK(report.conversion_bytes == 1024 * 1024);
+    CHECK(report.hyper_vector_size == 1024);
+
+    automatic.add(AutoTransferBuffers());
+    report = explain(automatic);
+    CHECK(report.conversion_bytes == 150000 * sizeof(double));
+    CHECK(report.hyper_vector_size == 150000);
+    CHECK(selection.read<std::vector<double>>(automatic) == std::vector<double>(150000, 0.0));
+
+    DataTransferProps limited;
+    limited.add(AutoTransferBuffers(1 << 20));
+    report = explain(limited);
+    CHECK(report.conversion_bytes == 1 << 20);
+    CHECK(report.hyper_vector_size == (1 << 20) / 32);
+
+    // Buffers of the caller are kept.
+    dxpl.add(AutoTransferBuffers());
+    CHECK(explain(dxpl).conversion_bytes == conversion.size());
+}
+
+TEST_CASE("Test explain transfer") {
+    const std::string file_name("h5_dataset_explain.h5");
+    File file(file_name, File::Truncate);
+
+    auto dcpl = DataSetCreateProps{};
+    dcpl.add(Chunking(std::vector<hsize_t>{4, 3}));
+    auto dataset = file.createDataSet("dset", DataSpace({10, 7}), create_datatype<int>(), dcpl);
+    dataset.select({0, 0}, {4, 6}).write(std::vector<std::vector<int>>(4, std::vector<int>(6, 1)));
+
+    auto everything = dataset.explain<std::vector<std::vector<int>>>();
+    CHECK(everything.selection_type == SelectionType::All);
+    CHECK(everything.n_blocks == 1);
+    CHECK(everything.n_elements == 70);
+    CHECK(everything.is_chunked);
+    CHECK(everything.n_chunks == 2);
+    CHECK(everything.chunk_bytes == 2 * 4 * 3 * sizeof(int));
+    CHECK(everything.conversion == ConversionPath::None);
+    CHECK(everything.copy_mode == CopyMode::Deep);
+    CHECK(everything.converter_bytes == 70 * sizeof(int));
+    CHECK(everything.conversion_bytes == 0);
+
+    // Only the chunk at {0, 3} is allocated and intersects the selection.
+    auto slab = dataset.select(HyperSlab(RegularHyperSlab({1, 4}, {2, 2})) |
+                               RegularHyperSlab({6, 4}, {2, 2}));
+    auto report = slab.explain<std::vector<double>>(TransferDirection::Write);
+    CHECK(report.selection_type == SelectionType::Hyperslabs);
+    CHECK(report.n_blocks == 2);
+    CHECK(report.n_elements == 8);
+    CHECK(report.n_chunks == 1);
+    CHECK(report.chunk_bytes == 4 * 3 * sizeof(int));
+    CHECK(report.conversion == ConversionPath::Hard);
+    CHECK(report.copy_mode == CopyMode::Shallow);
+    CHECK(report.converter_bytes == 0);
+    CHECK(report.conversion_bytes == 8 * sizeof(double));
+
+    auto points = dataset.select(ElementSet({0, 0, 9, 6})).explain<std::vector<int>>();
+    CHECK(points.selection_type == SelectionType::Points);
+    CHECK(points.n_blocks == 2);
+    CHECK(points.n_chunks == 1);
+
+    auto strings = file.createDataSet("strings", std::vector<std::string>{"a", "bc"});
+    auto string_report = strings.explain<std::vector<std::string>>();
+    CHECK(!string_report.is_chunked);
+    CHECK(string_report.n_chunks == 0);
+    CHECK(string_report.copy_mode == CopyMode::String);
+    CHECK(string_report.converter_bytes == 2 * sizeof(char*));
+}
+#endif
+
 template <class T>
 void check_invalid_hid_Object(T& obj) {
     auto silence = SilenceHDF5();
@@ -1226,6 +1589,87 @@ TEST_CASE("WriteLargeAttribute") {
     CHECK_NOTHROW(group.createAttribute("attr", large_attr));
 }
 
+TEST_CASE("ReadAllAttributes") {
+    File file("read_all_attributes.h5", File::Truncate);
+    auto dset = file.createDataSet("dset", 42);
+
+    dset.createAttribute("int", 3);
+    dset.createAttribute("uint", std::vector<uint8_t>{1, 2, 255});
+    dset.createAttribute("float", std::vector<std::vector<float>>{{1.5f, 2.5f}, {3.5f, 4.5f}});
+    dset.createAttribute("vlen", std::string("variable"));
+    dset.createAttribute("fixed", DataSpace(2), FixedLengthStringType(8, StringPadding::NullPadded))
+        .write(std::vector<std::string>{"a", "bcd"});
+    dset.createAttribute("bool", true);
+
+    auto attributes = dset.readAllAttributes();
+    REQUIRE(attributes.size() == 6);
+
+    const auto& int_value = attributes.at("int");
+    CHECK(int_value.getKind() == AttributeValue::Kind::Integer);
+    CHECK(int_value.getDimensions().empty());
+    CHECK(int_value.get<int>() == 3);
+    CHECK(int_value.get<double>() == 3.0);
+    CHECK(int_value.getDataType() == AtomicType<int>());
+    CHECK_THROWS_AS(int_value.get<std::string>(), DataTypeException);
+
+    const auto& uint_value = attributes.at("uint");
+    CHECK(uint_value.getKind() == AttributeValue::Kind::Unsigned);
+    CHECK(uint_value.getDimensions() == std::vector<size_t>{3});
+    CHECK(uint_value.get<std::vector<int>>() == std::vector<int>{1, 2, 255});
+    CHECK_THROWS_AS(uint_value.get<int>(), DataSpaceException);
+
+    const auto& float_value = attributes.at("float");
+    CHECK(float_value.getKind() == AttributeValue::Kind::Float);
+    CHECK(float_value.getDimensions() == std::vector<size_t>{2, 2});
+    CHECK(float_value.get<std::vector<double>>() == std::vector<double>{1.5, 2.5, 3.5, 4.5});
+
+    CHECK(attributes.at("vlen").getKind() == AttributeValue::Kind::String);
+    CHECK(attributes.at("vlen").get<std::string>() == "variable");
+    CHECK(attributes.at("fixed").get<std::vector<std::string>>() ==
+          std::vector<std::string>{"a", "bcd"});
+    CHECK_THROWS_AS(attributes.at("fixed").get<double>(), DataTypeException);
+
+    CHECK(attributes.at("bool").getKind() == AttributeValue::Kind::Other);
+    CHECK(attributes.at("bool").getDataType() == create_datatype<bool>());
+
+    CHECK(file.readAllAttributes().empty());
+}
+
+TEST_CASE("CreateAttributes") {
+    File file("create_attributes.h5", File::Truncate);
+    auto group = file.createGroup("group");
+
+    std::map<std::string, AttributeValue> attributes;
+    attributes["a"] = -7;
+    attributes["b"] = 2.5;
+    attributes["c"] = std::vector<uint32_t>{1, 2, 3};
+    attributes["d"] = std::vector<double>{1.0, 2.0, 3.0};
+    attributes["e"] = "text";
+    attributes["f"] = std::vector<std::string>{"x", "yz"};
+    group.createAttributes(attributes);
+
+    CHECK(group.getAttribute("a").read<int>() == -7);
+    CHECK(group.getAttribute("b").read<double>() == 2.5);
+    CHECK(group.getAttribute("c").read<std::vector<uint64_t>>() == std::vector<uint64_t>{1, 2, 3});
+    CHECK(group.getAttribute("d").read<std::vector<double>>() ==
+          std::vector<double>{1.0, 2.0, 3.0});
+    CHECK(group.getAttribute("e").read<std::string>() == "text");
+    CHECK(group.getAttribute("f").read<std::vector<std::string>>() ==
+          std::vector<std::string>{"x", "yz"});
+
+    auto roundtrip = group.readAllAttributes();
+    CHECK(roundtrip.at("a").get<int64_t>() == -7);
+    CHECK(roundtrip.at("c").get<std::vector<uint32_t>>() == std::vector<uint32_t>{1, 2, 3});
+    CHECK(roundtrip.at("f").get<std::vector<std::string>>() ==
+          std::vector<std::string>{"x", "yz"});
+
+    auto other = file.createGroup("other");
+    CHECK_NOTHROW(other.createAttributes(roundtrip));
+    CHECK(other.listAttributeNames() == group.listAttributeNames());
+    CHECK_THROWS_AS(other.createAttributes({{"invalid", AttributeValue()}}), DataTypeException);
+    CHECK_THROWS_AS(other.createAttributes({{"a", 1}}), AttributeException);
+}
+
 TEST_CASE("AttributePhaseChange") {
     auto fapl = HighFive::FileAccessProps::Default();
     fapl.add(HighFive::FileVersionBounds(H5F_LIBVER_LATEST, H5F_LIBVER_LATEST));
@@ -2112,6 +2556,821 @@ TEST_CASE("HighFivePropertyObjectsQuirks") {
     CHECK(pl3.getId() == pl2.getId());
 }
 
+TEST_CASE("HighFiveVisit") {
+    const std::string file_name("h5_visit.h5");
+    File file(file_name, File::ReadWrite | File::Create | File::Truncate);
+
+    file.createDataSet("a/b/x", std::vector<double>(3));
+    file.createDataSet("a/y", std::vector<std::vector<int>>(2, std::vector<int>(4)));
+    file.createGroup("c");
+    file.createSoftLink("a/soft", "/a/b/x");
+    H5Lcreate_hard(file.getId(), "a/b", file.getId(), "c/b_alias", H5P_DEFAULT, H5P_DEFAULT);
+
+    SECTION("basic") {
+        std::map<std::string, NodeInfo> nodes;
+        file.visit([&nodes](const NodeInfo& info) { nodes[info.path] = info; });
+
+        std::vector<std::string> paths;
+        for (const auto& kv: nodes) {
+            paths.push_back(kv.first);
+        }
+        // The content of "c/b_alias" is the same as "a/b" and isn't visited again.
+        CHECK(paths == std::vector<std::string>{
+                           "a", "a/b", "a/b/x", "a/soft", "a/y", "c", "c/b_alias"});
+
+        CHECK(nodes["a"].object_type == ObjectType::Group);
+        CHECK(nodes["a/b/x"].object_type == ObjectType::Dataset);
+        CHECK(nodes["a/b/x"].link_type == LinkType::Hard);
+        CHECK(nodes["a/b/x"].dimensions.empty());
+        CHECK(nodes["a/soft"].link_type == LinkType::Soft);
+        CHECK(nodes["a/soft"].object_type == ObjectType::Other);
+        CHECK(nodes["c/b_alias"].address == nodes["a/b"].address);
+    }
+
+    SECTION("fields") {
+        std::map<std::string, NodeInfo> nodes;
+        file.getGroup("a").visit([&nodes](const NodeInfo& info) { nodes[info.path] = info; },
+                                 VisitFields::Dimensions | VisitFields::DataType);
+
+        CHECK(nodes.size() == 4);
+        CHECK(nodes["b/x"].dimensions == std::vector<size_t>{3});
+        CHECK(nodes["b/x"].data_type == AtomicType<double>());
+        CHECK(nodes["y"].dimensions == std::vector<size_t>{2, 4});
+        CHECK(nodes["y"].data_type == AtomicType<int>());
+    }
+
+    SECTION("exceptions") {
+        size_t count = 0;
+        auto callback = [&count](const NodeInfo&) {
+            ++count;
+            throw std::runtime_error("stop");
+        };
+        CHECK_THROWS_AS(file.visit(callback), std::runtime_error);
+        CHECK(count == 1);
+    }
+
+    SECTION("iterateObjectNames") {
+        auto group = file.getGroup("a");
+        std::vector<std::string> names;
+        for (const auto& name: group.iterateObjectNames()) {
+            names.push_back(name);
+        }
+        CHECK(names == group.listObjectNames());
+
+        auto range = file.getGroup("c").iterateObjectNames();
+        auto it = range.begin();
+        REQUIRE(it != range.end());
+        CHECK(*it == "b_alias");
+        CHECK(++it == range.end());
+
+        auto empty = file.createGroup("empty").iterateObjectNames();
+        CHECK(empty.begin() == empty.end());
+
+        // More names than fit in the first batches.
+        auto many = file.createGroup("many");
+        for (int i = 0; i < 1000; ++i) {
+            many.createGroup("g" + std::to_string(i));
+        }
+        names.clear();
+        for (const auto& name: many.iterateObjectNames()) {
+            names.push_back(name);
+        }
+        CHECK(names == many.listObjectNames());
+    }
+}
+
+TEST_CASE("HighFiveStructureIndex") {
+    const std::string file_name("h5_structure_index.h5");
+    const std::string index_name("h5_structure_index.h5.idx");
+    std::remove(index_name.c_str());
+
+    {
+        File file(file_name, File::ReadWrite | File::Create | File::Truncate);
+        auto dset = file.createDataSet("a/b/x", std::vector<std::vector<double>>(2, {1.0, 2.0}));
+        dset.createAttribute("unit", std::string("m"));
+        file.createDataSet("a/y", 42);
+        file.createDataSet("a-z", std::vector<int>(5));
+        file.createAttribute("version", 3);
+        file.createSoftLink("a/soft", "/a/b/x");
+        H5Lcreate_hard(file.getId(), "a/b", file.getId(), "c", H5P_DEFAULT, H5P_DEFAULT);
+    }
+
+    File file(file_name, File::ReadWrite);
+    StructureIndex built(file);
+
+    auto check_index = [&file](const StructureIndex& index) {
+        CHECK(index.size() == 8);
+        CHECK(index.matches(file));
+
+        CHECK(index.exist("/a/b/x"));
+        CHECK(index.exist("a/b/x"));
+        CHECK(index.exist("a/soft"));
+        CHECK(index.exist("c/x"));
+        CHECK(!index.exist("a/missing"));
+        CHECK(!index.exist("c/missing"));
+
+        CHECK(index.getObjectType("/") == ObjectType::Group);
+        CHECK(index.getObjectType("a/b/") == ObjectType::Group);
+        CHECK(index.getObjectType("a/b/x") == ObjectType::Dataset);
+        CHECK(index.getObjectType("a/soft") == ObjectType::Other);
+        CHECK_THROWS_AS(index.getObjectType("a/missing"), ObjectException);
+
+        CHECK(index.getDimensions("a/b/x") == std::vector<size_t>{2, 2});
+        CHECK(index.getDimensions("c/x") == std::vector<size_t>{2, 2});
+        CHECK(index.getDimensions("a/y").empty());
+        CHECK(index.getDataType("a/b/x") == AtomicType<double>());
+        CHECK(index.getDataType("a-z") == AtomicType<int>());
+        CHECK_THROWS_AS(index.getDimensions("a"), DataSetException);
+
+        CHECK(index.listAttributeNames("/") == std::vector<std::string>{"version"});
+        CHECK(index.listAttributeNames("c/x") == std::vector<std::string>{"unit"});
+        CHECK(index.listAttributeNames("a").empty());
+
+        CHECK(index.listObjectNames() == std::vector<std::string>{"a", "a-z", "c"});
+        CHECK(index.listObjectNames("a") == std::vector<std::string>{"b", "soft", "y"});
+        CHECK(index.listObjectNames("c") == std::vector<std::string>{"x"});
+        CHECK_THROWS_AS(index.listObjectNames("a/y"), GroupException);
+
+        CHECK(index.getDataSet(file, "c/x").read<std::vector<std::vector<double>>>()[1][1] == 2.0);
+        CHECK_THROWS_AS(index.getDataSet(file, "a/missing"), ObjectException);
+        CHECK_THROWS_AS(index.getDataSet(file, "a/soft"), DataSetException);
+    };
+
+    check_index(built);
+
+    SECTION("stream") {
+        std::stringstream ss;
+        built.save(ss);
+        check_index(StructureIndex::load(ss));
+
+        std::stringstream garbage("not an index");
+        CHECK_THROWS_AS(StructureIndex::load(garbage), FileException);
+
+        auto data = ss.str();
+        std::stringstream truncated(data.substr(0, data.size() / 2));
+        CHECK_THROWS_AS(StructureIndex::load(truncated), FileException);
+
+        data[data.size() / 2] = static_cast<char>(~data[data.size() / 2]);
+        std::stringstream corrupt(data);
+        CHECK_THROWS_AS(StructureIndex::load(corrupt), FileException);
+    }
+
+    SECTION("sidecar") {
+        check_index(StructureIndex::loadOrBuild(file, index_name));
+        check_index(StructureIndex::load(index_name));
+        check_index(StructureIndex::loadOrBuild(file, index_name));
+
+        {
+            std::fstream sidecar(index_name, std::ios::binary | std::ios::in | std::ios::out);
+            sidecar.seekg(40);
+            auto byte = static_cast<char>(~sidecar.get());
+            sidecar.seekp(40);
+            sidecar.put(byte);
+        }
+        CHECK_THROWS_AS(StructureIndex::load(index_name), FileException);
+        check_index(StructureIndex::loadOrBuild(file, index_name));
+        check_index(StructureIndex::load(index_name));
+
+        file.createDataSet("d", std::vector<int>(1000));
+        file.flush();
+        CHECK(!StructureIndex::load(index_name).matches(file));
+        CHECK(StructureIndex::loadOrBuild(file, index_name).exist("d"));
+        CHECK(StructureIndex::load(index_name).exist("d"));
+
+        // Even if the link fits into the root group's header.
+        file.createSoftLink("e", "/d");
+        file.flush();
+        CHECK(!StructureIndex::load(index_name).matches(file));
+    }
+}
+
+TEST_CASE("HighFivePathCache") {
+    const std::string file_name("h5_path_cache.h5");
+    File file(file_name, File::ReadWrite | File::Create | File::Truncate);
+    file.createDataSet("a/b/x", std::vector<int>{1, 2, 3});
+    file.createDataSet("a/y", 42);
+    file.createSoftLink("a/soft", "/a/b");
+    file.createSoftLink("a/dangling", "/nowhere");
+
+    file.enablePathCache(4);
+
+    SECTION("exist") {
+        CHECK(file.exist("a/b/x"));
+        CHECK(file.exist("/a/b/x"));
+        CHECK(file.exist("a//b/x/"));
+        CHECK(file.exist("a/b"));
+        CHECK(file.exist("/"));
+        CHECK(!file.exist("a/b/z"));
+        CHECK(!file.exist("a/missing/z"));
+        CHECK(!file.exist("a/y/z"));
+        CHECK(file.exist("a/soft/x"));
+        CHECK(!file.exist("a/dangling/x"));
+
+        auto group = file.getGroup("a");
+        group.enablePathCache();
+        CHECK(group.exist("b/x"));
+        CHECK(group.exist("/a/b/x"));
+        CHECK(!group.exist("/b/x"));
+    }
+
+    SECTION("handles") {
+        auto dataset = file.getDataSet("a/b/x");
+        CHECK(file.getDataSet("a/b/x").getId() == dataset.getId());
+        CHECK(file.getDataSet("a/b/x").read<std::vector<int>>() == std::vector<int>{1, 2, 3});
+        CHECK(file.getGroup("a/b").getId() == file.getGroup("a/b/").getId());
+        CHECK_THROWS_AS(file.getGroup("a/b/x"), GroupException);
+        CHECK_THROWS_AS(file.getDataSet("a/b/z"), DataSetException);
+        CHECK_THROWS_AS(file.getDataSet("a/y/z"), DataSetException);
+
+        // Cached datasets have no children.
+        CHECK(!file.exist("a/b/x/z"));
+        CHECK_THROWS_AS(file.getDataSet("a/b/x/z"), DataSetException);
+
+        // Exceeding the capacity evicts the least recently used handles.
+        for (int i = 0; i < 8; ++i) {
+            file.createDataSet("c/d" + std::to_string(i), i);
+        }
+        for (int i = 0; i < 8; ++i) {
+            CHECK(file.getDataSet("c/d" + std::to_string(i)).read<int>() == i);
+        }
+        CHECK(file.getDataSet("a/b/x").read<std::vector<int>>() == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("invalidation") {
+        CHECK(file.exist("a/b/x"));
+        file.unlink("a/b/x");
+        CHECK(!file.exist("a/b/x"));
+        CHECK_THROWS_AS(file.getDataSet("a/b/x"), DataSetException);
+
+        file.getGroup("a/b");
+        CHECK(file.rename("a/b", "a/c"));
+        CHECK(!file.exist("a/b"));
+        CHECK(file.exist("a/c"));
+
+        file.createGroup("a/b");
+        CHECK(file.exist("a/b"));
+
+        file.disablePathCache();
+        CHECK(file.exist("a/b"));
+        CHECK(!file.exist("a/b/x"));
+    }
+}
+
+#ifdef H5_HAVE_THREADSAFE
+TEST_CASE("HighFivePathCache concurrent lookups") {
+    const std::string file_name("h5_path_cache_threads.h5");
+    File file(file_name, File::Truncate);
+    const size_t n_datasets = 16;
+    for (size_t i = 0; i < n_datasets; ++i) {
+        file.createDataSet("g/d" + std::to_string(i), i);
+    }
+
+    // Small enough that lookups evict each other's handles.
+    file.enablePathCache(4);
+    const File& const_file = file;
+
+    std::atomic<size_t> n_wrong{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&const_file, &n_wrong, t]() {
+            for (size_t k = 0; k < 500; ++k) {
+                size_t i = (k * 7 + t) % n_datasets;
+                auto path = "g/d" + std::to_string(i);
+                if (!const_file.exist(path) || const_file.getDataSet(path).read<size_t>() != i) {
+                    ++n_wrong;
+                }
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+
+    CHECK(n_wrong == 0);
+}
+#endif
+
+TEST_CASE("HighFiveStorageAudit") {
+    const std::string file_name("h5_storage_audit.h5");
+    File file(file_name, File::Truncate);
+
+    file.createDataSet("contiguous", std::vector<double>(100, 1.0));
+
+    DataSetCreateProps dcpl;
+    dcpl.add(Chunking(std::vector<hsize_t>{10, 10}));
+    dcpl.add(Deflate(9));
+    auto compressed =
+        file.createDataSet("group/compressed", DataSpace({40, 35}), create_datatype<int>(), dcpl);
+    auto zeros = std::vector<std::vector<int>>(20, std::vector<int>(10));
+    compressed.select({0, 0}, {20, 10}).write(zeros);
+    file.createHardLink("group/alias", compressed);
+
+    StorageAudit audit(file);
+    CHECK(audit.getFileName() == file_name);
+    CHECK(audit.getFileSize() == file.getFileSize());
+    CHECK(audit.getSuperblockSize() > 0);
+
+    const auto& datasets = audit.getDataSets();
+    REQUIRE(datasets.size() == 2);
+
+    const auto& contiguous = datasets[0];
+    CHECK(contiguous.path == "/contiguous");
+    CHECK(contiguous.layout == H5D_CONTIGUOUS);
+    CHECK(contiguous.logical_bytes == 100 * sizeof(double));
+    CHECK(contiguous.storage_bytes == 100 * sizeof(double));
+    CHECK(contiguous.getCompressionRatio() == 1.0);
+    CHECK(contiguous.chunk_dimensions.empty());
+    CHECK(contiguous.filters.empty());
+
+    const auto& chunked = datasets[1];
+    CHECK(chunked.path.find("/group/") == 0);
+    CHECK(chunked.layout == H5D_CHUNKED);
+    CHECK(chunked.dimensions == std::vector<size_t>{40, 35});
+    CHECK(chunked.logical_bytes == 40 * 35 * sizeof(int));
+    CHECK(chunked.chunk_dimensions == std::vector<hsize_t>{10, 10});
+    CHECK(chunked.n_possible_chunks == 4 * 4);
+    CHECK(chunked.n_allocated_chunks == 2);
+    CHECK(chunked.min_chunk_bytes > 0);
+    CHECK(chunked.max_chunk_bytes < 10 * 10 * sizeof(int));
+    CHECK(chunked.mean_chunk_bytes >= double(chunked.min_chunk_bytes));
+    CHECK(chunked.getCompressionRatio() > 1.0);
+    CHECK(chunked.filters == std::vector<std::string>{"deflate"});
+
+    CHECK(audit.getLogicalBytes() == contiguous.logical_bytes + chunked.logical_bytes);
+    CHECK(audit.getStorageBytes() == contiguous.storage_bytes + chunked.storage_bytes);
+
+    std::ostringstream csv;
+    audit.write(csv);
+    auto lines = csv.str();
+    CHECK(std::count(lines.begin(), lines.end(), '\n') == 3);
+    CHECK(lines.find("\"/contiguous\",contiguous,100,800,800,1,,0,0,0,0,0,\"\"\n") !=
+          std::string::npos);
+    CHECK(lines.find(",chunked,40x35,5600,") != std::string::npos);
+}
+
+TEST_CASE("HighFivePackedBits") {
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 3);
+
+    std::vector<size_t> sizes = {0, 1, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1001};
+    for (size_t n: sizes) {
+        INFO("n = " << n);
+        // Any non-zero byte is `true`.
+        std::vector<uint8_t> bytes(n);
+        for (auto& byte: bytes) {
+            byte = static_cast<uint8_t>(distribution(generator) * 85);
+        }
+        std::vector<bool> values(bytes.begin(), bytes.end());
+
+        std::vector<uint8_t> expected((n + 7) / 8, 0);
+        for (size_t i = 0; i < n; ++i) {
+            expected[i / 8] = static_cast<uint8_t>(expected[i / 8] | (values[i] ? 1 : 0) << i % 8);
+        }
+
+        std::vector<uint8_t> packed(expected.size(), 0xff);
+        details::pack_bits(bytes.data(), n, packed.data());
+        CHECK(packed == expected);
+
+        std::vector<uint8_t> unpacked(n, 0xff);
+        details::unpack_bits(packed.data(), n, unpacked.data());
+        CHECK(std::equal(values.begin(), values.end(), unpacked.begin()));
+        CHECK(std::all_of(unpacked.begin(), unpacked.end(), [](uint8_t v) { return v <= 1; }));
+
+#ifdef HIGHFIVE_SIMD_X86
+        std::fill(packed.begin(), packed.end(), 0xff);
+        details::pack_bits_sse2(bytes.data(), n, packed.data());
+        CHECK(packed == expected);
+        std::fill(unpacked.begin(), unpacked.end(), 0xff);
+        details::unpack_bits_sse2(expected.data(), n, unpacked.data());
+        CHECK(std::equal(values.begin(), values.end(), unpacked.begin()));
+#endif
+
+        PackedBits bits(values);
+        CHECK(bits.size() == n);
+        CHECK(bits.getByteSize() == expected.size());
+        CHECK(std::equal(expected.begin(), expected.end(), bits.data()));
+        CHECK(bits.toVector() == values);
+        CHECK(bits.count() == size_t(std::count(values.begin(), values.end(), true)));
+
+        std::unique_ptr<bool[]> bools(new bool[n + 1]);
+        bits.unpack(bools.get());
+        CHECK(std::equal(values.begin(), values.end(), bools.get()));
+        CHECK(PackedBits(bools.get(), n) == bits);
+    }
+
+    PackedBits bits(13, true);
+    CHECK(bits.count() == 13);
+    bits.set(3, false);
+    bits.set(12, false);
+    CHECK(!bits[3]);
+    CHECK(bits[4]);
+    CHECK(bits.count() == 11);
+    bits.resize(4);
+    bits.resize(9);
+    CHECK(bits.count() == 3);
+    CHECK(bits.toVector() == std::vector<bool>{1, 1, 1, 0, 0, 0, 0, 0, 0});
+
+    const std::string file_name("h5_packed_bits.h5");
+    File file(file_name, File::Truncate);
+
+    std::vector<bool> mask(1001);
+    for (size_t i = 0; i < mask.size(); ++i) {
+        mask[i] = i % 3 == 0 || i % 7 == 0;
+    }
+    auto dataset = file.createDataSet("mask", PackedBits(mask));
+    CHECK(dataset.getDataType().getClass() == DataTypeClass::BitField);
+    CHECK(dataset.getDataType().getSize() == 1);
+    CHECK(dataset.getDimensions() == std::vector<size_t>{126});
+    CHECK(dataset.getStorageSize() == 126);
+
+    auto read = dataset.read<PackedBits>();
+    CHECK(read.size() == 1008);
+    read.resize(mask.size());
+    CHECK(read.toVector() == mask);
+
+    // Selections are in bytes.
+    auto slab = dataset.select({2}, {3}).read<PackedBits>();
+    CHECK(slab.toVector() == std::vector<bool>(mask.begin() + 16, mask.begin() + 40));
+
+    // The number of bits survives with `PackedBits::create` and `PackedBits::read`.
+    auto counted = PackedBits::create(file, "counted", PackedBits(mask));
+    CHECK(counted.getDimensions() == std::vector<size_t>{126});
+    CHECK(PackedBits::read(counted).toVector() == mask);
+    CHECK(PackedBits::read(dataset).size() == 1008);
+    counted.getAttribute("highfive_bit_count").write(uint64_t(1009));
+    CHECK_THROWS_AS(PackedBits::read(counted), DataSetException);
+
+    // `std::vector<bool>` still uses one byte per element.
+    auto unpacked = file.createDataSet("unpacked", mask);
+    CHECK(unpacked.getStorageSize() == mask.size());
+    CHECK(unpacked.read<std::vector<bool>>() == mask);
+    auto unpacked_slab = unpacked.select({3}, {70}).read<std::vector<bool>>();
+    CHECK(unpacked_slab == std::vector<bool>(mask.begin() + 3, mask.begin() + 73));
+}
+
+TEST_CASE("HighFiveStringTable") {
+    for (char pad: {' ', '\0'}) {
+        for (size_t length = 0; length < 40; ++length) {
+            for (size_t n_pads = 0; n_pads <= length; ++n_pads) {
+                std::string str(length - n_pads, 'x');
+                str += std::string(n_pads, pad);
+                CHECK(details::trimmed_length(str.data(), str.size(), pad) == length - n_pads);
+            }
+        }
+    }
+    CHECK(details::char_buffer_length("abc\0def", 7) == 3);
+    CHECK(details::char_buffer_length("abcdef", 3) == 3);
+    CHECK(details::char_buffer_length("abcdef", size_t(-1)) == 6);
+
+    std::vector<std::string> strings = {"",
+                                        "a",
+                                        "two words",
+                                        "with trailing spaces  ",
+                                        std::string(30, 'y'),
+                                        " leading space"};
+    StringTable table(strings);
+    CHECK(table.size() == strings.size());
+    CHECK(table.getArenaSize() == 76 + strings.size());
+    CHECK(table.toVector() == strings);
+    for (size_t i = 0; i < strings.size(); ++i) {
+        CHECK(table.length(i) == strings[i].size());
+        CHECK(std::strcmp(table.data(i), strings[i].c_str()) == 0);
+        CHECK(table.getString(i) == strings[i]);
+#if HIGHFIVE_CXX_STD >= 17
+        CHECK(table[i] == strings[i]);
+#endif
+    }
+
+    table.clear();
+    CHECK(table.empty());
+    table.push_back("abc");
+    CHECK(table.toVector() == std::vector<std::string>{"abc"});
+
+    const std::string file_name("h5_string_table.h5");
+    File file(file_name, File::Truncate);
+
+    // Variable length strings are written without copies.
+    auto variable = file.createDataSet("variable", StringTable(strings));
+    CHECK(variable.getDataType().isVariableStr());
+    CHECK(variable.read<std::vector<std::string>>() == strings);
+    CHECK(variable.read<StringTable>().toVector() == strings);
+    CHECK(variable.select({2}, {3}).read<StringTable>().toVector() ==
+          std::vector<std::string>(strings.begin() + 2, strings.begin() + 5));
+
+    // The padding of fixed-length strings is removed.
+    for (auto padding: {StringPadding::NullTerminated,
+                        StringPadding::NullPadded,
+                        StringPadding::SpacePadded}) {
+        INFO("padding " << static_cast<int>(padding));
+        auto name = "fixed" + std::to_string(static_cast<int>(padding));
+        auto fixed = file.createDataSet(name,
+                                        DataSpace::From(strings),
+                                        FixedLengthStringType(32, padding));
+        fixed.write(StringTable(strings));
+
+        auto read = fixed.read<StringTable>();
+        REQUIRE(read.size() == strings.size());
+        for (size_t i = 0; i < strings.size(); ++i) {
+            auto expected = strings[i];
+            if (padding == StringPadding::SpacePadded) {
+                expected.erase(expected.find_last_not_of(' ') + 1);
+            }
+            CHECK(read.getString(i) == expected);
+            CHECK(read.data(i)[read.length(i)] == '\0');
+        }
+    }
+}
+
+namespace {
+struct CountingAllocator {
+    size_t n_allocations = 0;
+    size_t n_frees = 0;
+
+    static void* allocate(size_t size, void* info) {
+        static_cast<CountingAllocator*>(info)->n_allocations += 1;
+        return std::malloc(size);
+    }
+
+    static void free(void* ptr, void* info) {
+        static_cast<CountingAllocator*>(info)->n_frees += ptr != nullptr ? 1 : 0;
+        std::free(ptr);
+    }
+};
+}  // namespace
+
+TEST_CASE("HighFiveVlenArena") {
+    details::VlenArena aligned;
+    for (size_t size: std::vector<size_t>{0, 1, 7, 17, 100000, 3}) {
+        auto ptr = reinterpret_cast<uintptr_t>(aligned.allocate(size));
+        CHECK(ptr % alignof(std::max_align_t) == 0);
+    }
+
+    // Blocks grow geometrically, from 64 KiB.
+    details::VlenArena packed(1);
+    auto first = static_cast<char*>(packed.allocate(10));
+    CHECK(static_cast<char*>(packed.allocate(7)) == first + 10);
+    for (size_t i = 0; i < 10000; ++i) {
+        packed.allocate(100);
+    }
+    CHECK(packed.getBlockCount() == 5);
+
+    const std::string file_name("h5_vlen_arena.h5");
+    File file(file_name, File::Truncate);
+    std::vector<std::string> strings(1000);
+    for (size_t i = 0; i < strings.size(); ++i) {
+        strings[i] = std::string(i % 50, char('a' + i % 26));
+    }
+    auto dataset = file.createDataSet("strings", strings);
+
+    CHECK(dataset.read<std::vector<std::string>>() == strings);
+    CHECK(dataset.select({10}, {20}).read<std::vector<std::string>>() ==
+          std::vector<std::string>(strings.begin() + 10, strings.begin() + 30));
+    DataTransferProps auto_buffers;
+    auto_buffers.add(AutoTransferBuffers());
+    CHECK(dataset.read<std::vector<std::string>>(auto_buffers) == strings);
+
+    // A memory manager set by the caller is used instead.
+    CountingAllocator allocator;
+    RawPropertyList<PropertyType::DATASET_XFER> xfer_props;
+    xfer_props.add(H5Pset_vlen_mem_manager,
+                   &CountingAllocator::allocate,
+                   static_cast<void*>(&allocator),
+                   &CountingAllocator::free,
+                   static_cast<void*>(&allocator));
+    CHECK(dataset.read<std::vector<std::string>>(xfer_props) == strings);
+    CHECK(allocator.n_allocations == strings.size());
+    CHECK(allocator.n_frees == strings.size());
+}
+
+TEST_CASE("HighFiveStringColumn") {
+    const std::string file_name("h5_string_column.h5");
+
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 5000; ++i) {
+        strings.push_back("name_" + std::to_string(i) + std::string(i % 7, 'x'));
+    }
+    strings[3] = "";
+    strings[4] = std::string("a\0b", 3);
+    strings[5] = "\xc3\xa9t\xc3\xa9";
+
+    auto chunk_dims = [](const DataSet& dataset) {
+        auto props = dataset.getCreatePropertyList();
+        return Chunking(props).getDimensions();
+    };
+
+    {
+        File file(file_name, File::Truncate);
+        DataSetCreateProps props;
+        props.add(Chunking(1024));
+        props.add(Shuffle());
+        props.add(Deflate(4));
+        auto column = StringColumn::create(file, "columns/names", strings, props);
+        CHECK(column.size() == strings.size());
+
+        auto bytes = column.getGroup().getDataSet("bytes");
+        auto offsets = column.getGroup().getDataSet("offsets");
+        CHECK(chunk_dims(bytes) == std::vector<hsize_t>{1024});
+        CHECK(chunk_dims(offsets) == std::vector<hsize_t>{128});
+        CHECK(offsets.getElementCount() == strings.size() + 1);
+
+        auto empty = StringColumn::create(file, "empty", std::vector<std::string>{});
+        CHECK(empty.size() == 0);
+        CHECK(empty.getByteSize() == 0);
+        CHECK(empty.read().empty());
+        CHECK(chunk_dims(empty.getGroup().getDataSet("bytes")) ==
+              std::vector<hsize_t>{256 * 1024});
+
+        file.createGroup("group");
+        file.createDataSet("dataset", strings);
+    }
+
+    File file(file_name, File::ReadWrite);
+    CHECK(StringColumn::isStringColumn(file, "columns/names"));
+    CHECK(StringColumn::isStringColumn(file.getGroup("columns"), "names"));
+    CHECK(!StringColumn::isStringColumn(file, "group"));
+    CHECK(!StringColumn::isStringColumn(file, "dataset"));
+    CHECK(!StringColumn::isStringColumn(file, "missing"));
+    CHECK_THROWS_AS(StringColumn::open(file, "group"), GroupException);
+
+    auto column = StringColumn::open(file, "columns/names");
+    size_t n_bytes = 0;
+    for (const auto& s: strings) {
+        n_bytes += s.size();
+    }
+    CHECK(column.getByteSize() == n_bytes);
+    CHECK(column.read() == strings);
+    CHECK(column.read(0, 0).empty());
+    CHECK(column.read(3, 3) == std::vector<std::string>(strings.begin() + 3, strings.begin() + 6));
+    CHECK(column.read(1234, 2000) ==
+          std::vector<std::string>(strings.begin() + 1234, strings.begin() + 3234));
+    CHECK(column.read(4999, 1) == std::vector<std::string>{strings.back()});
+    CHECK_THROWS_AS(column.read(4999, 2), DataSpaceException);
+
+    auto table = column.readTable(2, 4);
+    CHECK(table.size() == 4);
+    CHECK(table.toVector() == std::vector<std::string>(strings.begin() + 2, strings.begin() + 6));
+    CHECK(column.readTable().toVector() == strings);
+
+    std::vector<std::string> more{"appended", "", "last"};
+    column.append(more);
+    column.append({});
+    strings.insert(strings.end(), more.begin(), more.end());
+    CHECK(column.size() == strings.size());
+    CHECK(StringColumn::open(file, "columns/names").read() == strings);
+    CHECK(column.read(4999, 4) ==
+          std::vector<std::string>(strings.begin() + 4999, strings.end()));
+
+    auto last = column.readTable(4999, 4);
+    CHECK(last.getArenaSize() == strings[4999].size() + 8 + 4 + 4);
+    CHECK(std::string(last.data(1)) == "appended");
+    CHECK(last.length(2) == 0);
+    CHECK(std::string(last.data(3)) == "last");
+
+    // The offsets are checked before indexing the bytes.
+    auto offsets = file.getDataSet("columns/names/offsets");
+    auto offset_2 = offsets.select({2}, {1}).read<std::vector<uint64_t>>();
+    offsets.select({2}, {1}).write(std::vector<uint64_t>{0});
+    CHECK_THROWS_AS(column.read(0, 3), DataSetException);
+    CHECK_THROWS_AS(column.readTable(1, 2), DataSetException);
+    CHECK(column.read(3, 3) == std::vector<std::string>(strings.begin() + 3, strings.begin() + 6));
+    offsets.select({2}, {1}).write(offset_2);
+
+    offsets.select({column.size()}, {1}).write(std::vector<uint64_t>{n_bytes + 1000});
+    CHECK_THROWS_AS(column.read(), DataSetException);
+    CHECK_THROWS_AS(column.readTable(column.size() - 1, 1), DataSetException);
+}
+
+TEST_CASE("HighFiveTryGet") {
+    const std::string file_name("h5_try_get.h5");
+    File file(file_name, File::Truncate);
+    auto dataset = file.createDataSet("a/b/x", std::vector<int>{1, 2, 3});
+    dataset.createAttribute("attr", 42);
+    file.createSoftLink("a/dangling", "/nowhere");
+
+    auto check_lookups = [&]() {
+        auto found = file.tryGetDataSet("a/b/x");
+        REQUIRE(found.has_value());
+        CHECK(found->read<std::vector<int>>() == std::vector<int>{1, 2, 3});
+        CHECK(file.tryGetDataSet("/a/b/x"));
+        CHECK(file.getGroup("a").tryGetDataSet("b/x"));
+
+        CHECK(!file.tryGetDataSet("a/b/z"));
+        CHECK(!file.tryGetDataSet("a/missing/x"));
+        CHECK(!file.tryGetDataSet("a/b/x/y"));
+        CHECK(!file.tryGetDataSet("a/b"));
+        CHECK(!file.tryGetDataSet("a/dangling"));
+        CHECK(!file.tryGetDataSet("/"));
+        CHECK(!file.tryGetDataSet(""));
+        CHECK_THROWS_AS(file.tryGetDataSet("a/b").value(), Exception);
+
+        std::vector<int> values;
+        CHECK(file.tryRead("a/b/x", values));
+        CHECK(values == std::vector<int>{1, 2, 3});
+        CHECK(!file.tryRead("a/b/z", values));
+
+        CHECK(file.tryRead<std::vector<int>>("a/b/x").value() == std::vector<int>{1, 2, 3});
+        CHECK(file.tryRead<int>("a/b/z").value_or(-1) == -1);
+
+        DataTransferProps xfer_props;
+        xfer_props.add(AutoTransferBuffers());
+        CHECK(file.tryRead("a/b/x", values, xfer_props));
+        CHECK(file.tryRead<std::vector<int>>("a/b/x", xfer_props).value() == values);
+
+        // Only missing datasets aren't errors.
+        CHECK_THROWS_AS(file.tryRead<int>("a/b/x"), DataSpaceException);
+    };
+
+    check_lookups();
+
+    file.enablePathCache();
+    check_lookups();
+    check_lookups();
+
+    auto attribute = dataset.tryGetAttribute("attr");
+    REQUIRE(attribute.has_value());
+    CHECK(attribute->read<int>() == 42);
+    CHECK(!dataset.tryGetAttribute("missing"));
+    CHECK(!file.tryGetAttribute("attr"));
+
+    // A miss leaves the HDF5 error stack empty.
+    H5Eclear2(H5E_DEFAULT);
+    CHECK(!dataset.tryGetAttribute("missing"));
+    CHECK(H5Eget_num(H5E_DEFAULT) == 0);
+}
+
+TEST_CASE("HighFiveCreateGroups") {
+    File file("h5_create_groups.h5", File::Truncate);
+    file.createGroup("existing");
+
+    auto gcpl = GroupCreateProps::Default();
+    gcpl.add(LinkCreationOrder(CreationOrder::Tracked | CreationOrder::Indexed));
+
+    file.createGroups({"a/b/c", "a/b", "existing/d", "a/b-x", "/abs/e", "a/b/c/f", "a/b"}, gcpl);
+
+    CHECK(file.listObjectNames() == std::vector<std::string>{"a", "abs", "existing"});
+    CHECK(file.getGroup("a").listObjectNames() == std::vector<std::string>{"b", "b-x"});
+    CHECK(file.getGroup("a/b").listObjectNames() == std::vector<std::string>{"c"});
+    CHECK(file.getGroup("a/b/c").listObjectNames() == std::vector<std::string>{"f"});
+    CHECK(file.exist("existing/d"));
+    CHECK(file.exist("abs/e"));
+
+    auto flags = [&file](const std::string& path) {
+        auto props = file.getGroup(path).getCreatePropertyList();
+        return LinkCreationOrder(props).getFlags();
+    };
+    // Only the requested groups use the given properties.
+    CHECK((flags("a/b") & CreationOrder::Tracked) != 0);
+    CHECK((flags("a/b/c") & CreationOrder::Tracked) != 0);
+    CHECK((flags("a") & CreationOrder::Tracked) == 0);
+
+    auto group = file.getGroup("a");
+    group.createGroups({"g/h", "/root_level"});
+    CHECK(file.exist("a/g/h"));
+    CHECK(file.exist("root_level"));
+
+    CHECK_THROWS_AS(file.createGroups({"new", "existing"}), GroupException);
+    CHECK_THROWS_AS(file.createGroups({"/"}), GroupException);
+}
+
+TEST_CASE("HighFiveCreationContext") {
+    File file("h5_creation_context.h5", File::Truncate);
+
+    DataSetCreateProps dcpl;
+    dcpl.add(Chunking(std::vector<hsize_t>{2}));
+    dcpl.add(Deflate(3));
+
+    auto context = file.prepareCreation(dcpl);
+    for (int i = 0; i < 10; ++i) {
+        context.createDataSet("data/" + std::to_string(i), std::vector<int>{i, i + 1, i + 2});
+    }
+    context.createDataSet<float>("empty", DataSpace({3}));
+    context.createDataSet("typed", DataSpace({4}), AtomicType<int16_t>());
+    context.createGroup("group/nested");
+
+    auto contiguous = file.prepareCreation();
+    contiguous.createDataSet("scalar", 2.5);
+
+    CHECK(file.getGroup("data").getNumberObjects() == 10);
+    for (int i = 0; i < 10; ++i) {
+        auto dataset = file.getDataSet("data/" + std::to_string(i));
+        CHECK(dataset.read<std::vector<int>>() == std::vector<int>{i, i + 1, i + 2});
+        auto props = dataset.getCreatePropertyList();
+        CHECK(Chunking(props).getDimensions() == std::vector<hsize_t>{2});
+    }
+    CHECK(file.getDataSet("scalar").read<double>() == 2.5);
+    CHECK(file.getDataSet("empty").getDataType() == AtomicType<float>());
+    CHECK(file.getDataSet("typed").getDataType() == AtomicType<int16_t>());
+    CHECK(file.exist("group/nested"));
+
+    CHECK_THROWS_AS(contiguous.createDataSet("scalar", 1), DataSetException);
+
+    auto strict = file.prepareCreation(DataSetCreateProps::Default(),
+                                       DataSetAccessProps::Default(),
+                                       GroupCreateProps::Default(),
+                                       false);
+    CHECK_THROWS_AS(strict.createDataSet("missing/x", 1), DataSetException);
+}
+
 TEST_CASE("HighFiveLinkCreationOrderProperty") {
     {  // For file
         const std::string file_name("h5_keep_creation_order_file.h5");
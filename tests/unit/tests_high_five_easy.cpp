@@ -188,6 +188,109 @@ TEST_CASE("H5Easy_Attribute_scalar") {
     CHECK(c == c_r);
 }
 
+TEST_CASE("H5Easy_Session") {
+    H5Easy::File file("h5easy_session.h5", H5Easy::File::Overwrite);
+    H5Easy::Session session(file);
+
+    std::vector<double> a = {1.0, 2.0, 3.0};
+    session.dump("/path/to/a", a);
+    CHECK_THROWS(session.dump("/path/to/a", a));
+
+    for (size_t i = 0; i < 5; ++i) {
+        a[0] = double(i);
+        session.dump("path/to/a", a, H5Easy::DumpMode::Overwrite);
+        CHECK(session.load<std::vector<double>>("/path/to/a") == a);
+        CHECK(H5Easy::load<std::vector<double>>(file, "/path/to/a") == a);
+    }
+
+    CHECK(session.getShape("/path/to/a") == std::vector<size_t>{3});
+    CHECK(session.getSize("/path/to/a") == 3);
+    CHECK_THROWS(session.dump("/path/to/a", std::vector<double>{1.0}, H5Easy::DumpMode::Overwrite));
+
+    session.dumpAttribute("/path/to/a", "b", 42);
+    session.dumpAttribute("/path/to/a", "b", 43, H5Easy::DumpMode::Overwrite);
+    CHECK(session.loadAttribute<int>("/path/to/a", "b") == 43);
+    CHECK(H5Easy::loadAttribute<int>(file, "/path/to/a", "b") == 43);
+
+    // Unlinking through the session drops the cached handles.
+    session.unlink("/path/to");
+    CHECK(!file.exist("/path/to/a"));
+    session.dump("/path/to/a", std::vector<double>{4.0});
+    CHECK(session.load<std::vector<double>>("/path/to/a") == std::vector<double>{4.0});
+
+    session.rename("/path/to/a", "/path/to/c");
+    CHECK_THROWS(session.load<std::vector<double>>("/path/to/a"));
+    CHECK(session.load<std::vector<double>>("/path/to/c") == std::vector<double>{4.0});
+}
+
+TEST_CASE("H5Easy_batch") {
+    H5Easy::File file("h5easy_batch.h5", H5Easy::File::Overwrite);
+
+    SECTION("1D contiguous") {
+        std::vector<std::vector<size_t>> indices;
+        std::vector<double> values;
+        for (size_t i = 0; i < 10; ++i) {
+            indices.push_back({i});
+            values.push_back(double(i));
+        }
+
+        H5Easy::dumpBatch(file, "/path/to/A", values, indices);
+        CHECK(H5Easy::getShape(file, "/path/to/A") == std::vector<size_t>{10});
+
+        indices = {{10}, {11}, {12}};
+        H5Easy::dumpBatch(file, "/path/to/A", std::vector<double>{10.0, 11.0, 12.0}, indices);
+        CHECK(H5Easy::getShape(file, "/path/to/A") == std::vector<size_t>{13});
+
+        auto A = H5Easy::load<std::vector<double>>(file, "/path/to/A");
+        for (size_t i = 0; i < A.size(); ++i) {
+            CHECK(A[i] == double(i));
+        }
+        CHECK(H5Easy::loadBatch<double>(file, "/path/to/A", {{3}, {4}, {5}}) ==
+              std::vector<double>{3.0, 4.0, 5.0});
+    }
+
+    SECTION("2D points") {
+        std::vector<std::vector<size_t>> indices = {{0, 0}, {3, 1}, {1, 4}};
+        H5Easy::dumpBatch(file, "/path/to/B", std::vector<int>{1, 2, 3}, indices);
+        CHECK(H5Easy::getShape(file, "/path/to/B") == std::vector<size_t>{4, 5});
+
+        CHECK(H5Easy::load<int>(file, "/path/to/B", {3, 1}) == 2);
+        CHECK(H5Easy::loadBatch<int>(file, "/path/to/B", {{1, 4}, {0, 0}}) ==
+              std::vector<int>{3, 1});
+
+        // Mismatched ranks and sizes are rejected.
+        CHECK_THROWS(H5Easy::dumpBatch(file, "/path/to/B", std::vector<int>{1}, {{0}}));
+        CHECK_THROWS(H5Easy::dumpBatch(file, "/path/to/B", std::vector<int>{1, 2}, {{0, 0}}));
+    }
+
+    SECTION("empty") {
+        CHECK_THROWS(H5Easy::dumpBatch(file, "/path/to/C", std::vector<int>{}, {}));
+        CHECK(!file.exist("/path/to/C"));
+
+        H5Easy::dumpBatch(file, "/path/to/C", std::vector<int>{1}, {{2}});
+        H5Easy::dumpBatch(file, "/path/to/C", std::vector<int>{}, {});
+        CHECK(H5Easy::getShape(file, "/path/to/C") == std::vector<size_t>{3});
+    }
+
+    SECTION("geometric growth") {
+        H5Easy::DumpOptions options(H5Easy::Growth::Geometric);
+        for (size_t i = 0; i < 10; ++i) {
+            H5Easy::dump(file, "/path/to/D", int(i), {i}, options);
+        }
+        CHECK(H5Easy::getShape(file, "/path/to/D") == std::vector<size_t>{16});
+
+        auto D = H5Easy::load<std::vector<int>>(file, "/path/to/D");
+        for (size_t i = 0; i < 10; ++i) {
+            CHECK(D[i] == int(i));
+        }
+
+        H5Easy::dumpBatch(file, "/path/to/D", std::vector<int>{16, 17}, {{16}, {17}}, options);
+        CHECK(H5Easy::getShape(file, "/path/to/D") == std::vector<size_t>{32});
+        CHECK(H5Easy::loadBatch<int>(file, "/path/to/D", {{16}, {17}}) ==
+              std::vector<int>{16, 17});
+    }
+}
+
 #ifdef HIGHFIVE_TEST_XTENSOR
 TEST_CASE("H5Easy_extend1d") {
     H5Easy::File file("h5easy_extend1d.h5", H5Easy::File::Overwrite);
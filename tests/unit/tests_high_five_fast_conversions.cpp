@@ -0,0 +1,574 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+// Tests which register HighFive's conversions with HDF5. Unregistering them
+// doesn't bring back HDF5's built-in hard conversions, i.e. any later test in
+// the same process would run on HDF5's soft conversions. Hence, these tests
+// have their own executable.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#define HIGHFIVE_ENABLE_INSTRUMENTATION
+#include <highfive/highfive.hpp>
+#include <highfive/H5FastConversion.hpp>
+#include <highfive/bfloat16.hpp>
+
+using namespace HighFive;
+
+namespace {
+// Converts with `H5Tconvert`, `input` holds values of type `src`.
+std::vector<unsigned char> h5t_convert(hid_t src,
+                                       hid_t dst,
+                                       std::vector<unsigned char> input,
+                                       hid_t dxpl = H5P_DEFAULT) {
+    size_t src_size = H5Tget_size(src);
+    size_t dst_size = H5Tget_size(dst);
+    size_t n = input.size() / src_size;
+    input.resize(n * std::max(src_size, dst_size));
+    REQUIRE(H5Tconvert(src, dst, n, input.data(), nullptr, dxpl) >= 0);
+    input.resize(n * dst_size);
+    return input;
+}
+
+template <class T>
+std::vector<unsigned char> as_bytes(const std::vector<T>& values) {
+    std::vector<unsigned char> bytes(values.size() * sizeof(T));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return bytes;
+}
+
+class BigEndianFloat: public DataType {
+  public:
+    BigEndianFloat() {
+        _hid = H5Tcopy(H5T_IEEE_F32BE);
+    }
+};
+
+H5T_conv_ret_t clamp_to_float(H5T_conv_except_t except,
+                              hid_t /* src_id */,
+                              hid_t /* dst_id */,
+                              void* /* src */,
+                              void* dst,
+                              void* /* data */) {
+    float value = except == H5T_CONV_EXCEPT_RANGE_HI ? std::numeric_limits<float>::max()
+                                                     : std::numeric_limits<float>::lowest();
+    std::memcpy(dst, &value, sizeof(float));
+    return H5T_CONV_HANDLED;
+}
+}  // namespace
+
+TEST_CASE("HighFiveFastConversions") {
+    // Unregister the conversions, even if a check fails. The built-in hard
+    // conversions they replaced aren't restored.
+    struct Unregister {
+        ~Unregister() {
+            unregister_fast_conversions();
+        }
+    } unregister;
+
+    // Enough values for several blocks and a remainder for every SIMD width.
+    const size_t n = 1237;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> mantissa(-2.0, 2.0);
+    std::uniform_int_distribution<int> exponent(-160, 160);
+    std::uniform_int_distribution<int32_t> int32(std::numeric_limits<int32_t>::min());
+    std::uniform_int_distribution<int64_t> int64(std::numeric_limits<int64_t>::min());
+
+    // The last two would be rounded to `FLT_MAX`, HDF5 converts them to infinity.
+    const auto float_max = static_cast<double>(std::numeric_limits<float>::max());
+    std::vector<double> doubles = {0.0,
+                                   -0.0,
+                                   1e300,
+                                   -1e300,
+                                   std::numeric_limits<double>::infinity(),
+                                   1e-45,
+                                   float_max,
+                                   float_max * 1.00000001,
+                                   -float_max * 1.00000001};
+    std::vector<float> floats;
+    std::vector<int16_t> int16s;
+    std::vector<int32_t> int32s;
+    std::vector<int64_t> int64s;
+    while (doubles.size() < n) {
+        doubles.push_back(std::ldexp(mantissa(gen), exponent(gen)));
+    }
+    for (size_t i = 0; i < n; ++i) {
+        floats.push_back(static_cast<float>(std::ldexp(mantissa(gen), exponent(gen) / 2)));
+        int16s.push_back(static_cast<int16_t>(int32(gen)));
+        int32s.push_back(int32(gen));
+        int64s.push_back(int64(gen));
+    }
+
+    struct Case {
+        hid_t src;
+        hid_t dst;
+        std::vector<unsigned char> input;
+        std::vector<unsigned char> expected;
+    };
+
+    // The input in the byte order of `src`.
+    auto make_case = [](hid_t native, hid_t src, hid_t dst, std::vector<unsigned char> values) {
+        auto input = h5t_convert(native, src, std::move(values));
+        return Case{src, dst, input, h5t_convert(src, dst, input)};
+    };
+
+    // HDF5's own conversions, before the fast ones are registered.
+    std::vector<Case> cases = {
+        make_case(H5T_NATIVE_INT16, H5T_NATIVE_INT16, H5T_NATIVE_DOUBLE, as_bytes(int16s)),
+        make_case(H5T_NATIVE_INT32, H5T_NATIVE_INT32, H5T_NATIVE_DOUBLE, as_bytes(int32s)),
+        make_case(H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT, H5T_NATIVE_DOUBLE, as_bytes(floats)),
+        make_case(H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, as_bytes(doubles)),
+        make_case(H5T_NATIVE_INT16, H5T_STD_I16BE, H5T_NATIVE_DOUBLE, as_bytes(int16s)),
+        make_case(H5T_NATIVE_INT32, H5T_STD_I32BE, H5T_NATIVE_DOUBLE, as_bytes(int32s)),
+        make_case(H5T_NATIVE_FLOAT, H5T_IEEE_F32BE, H5T_NATIVE_DOUBLE, as_bytes(floats)),
+        make_case(H5T_NATIVE_INT16, H5T_STD_I16BE, H5T_NATIVE_INT16, as_bytes(int16s)),
+        make_case(H5T_NATIVE_INT16, H5T_NATIVE_INT16, H5T_STD_I16BE, as_bytes(int16s)),
+        make_case(H5T_NATIVE_INT32, H5T_STD_I32BE, H5T_NATIVE_INT32, as_bytes(int32s)),
+        make_case(H5T_NATIVE_INT64, H5T_STD_I64BE, H5T_NATIVE_INT64, as_bytes(int64s)),
+        make_case(H5T_NATIVE_FLOAT, H5T_IEEE_F32BE, H5T_NATIVE_FLOAT, as_bytes(floats)),
+        make_case(H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_IEEE_F64BE, as_bytes(doubles)),
+    };
+
+    // HDF5 converts big-endian `double` to `float` in software, which rounds
+    // differently. The fast conversions follow the native one.
+    auto native_floats = h5t_convert(H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, as_bytes(doubles));
+    cases.push_back(
+        {H5T_IEEE_F64BE,
+         H5T_NATIVE_FLOAT,
+         h5t_convert(H5T_NATIVE_DOUBLE, H5T_IEEE_F64BE, as_bytes(doubles)),
+         native_floats});
+    cases.push_back({H5T_NATIVE_DOUBLE,
+                     H5T_IEEE_F32BE,
+                     as_bytes(doubles),
+                     h5t_convert(H5T_NATIVE_FLOAT, H5T_IEEE_F32BE, native_floats)});
+
+    std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+    for (auto level: {SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level <= get_supported_simd_level()) {
+            levels.push_back(level);
+        }
+    }
+
+    for (auto level: levels) {
+        register_fast_conversions(level);
+        REQUIRE(get_fast_conversion_simd_level() == level);
+
+        for (size_t i = 0; i < cases.size(); ++i) {
+            const auto& c = cases[i];
+            INFO("level " << static_cast<int>(level) << ", case " << i);
+            CHECK(H5Tcompiler_conv(c.src, c.dst) > 0);
+            CHECK(h5t_convert(c.src, c.dst, c.input) == c.expected);
+        }
+    }
+
+    // The exception callback is called for values outside the range of `float`.
+    auto dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_type_conv_cb(dxpl, clamp_to_float, nullptr);
+    auto clamped = h5t_convert(H5T_NATIVE_DOUBLE, H5T_NATIVE_FLOAT, as_bytes(doubles), dxpl);
+    H5Pclose(dxpl);
+    std::vector<float> clamped_floats(n);
+    std::memcpy(clamped_floats.data(), clamped.data(), clamped.size());
+    for (size_t i = 0; i < n; ++i) {
+        if (std::abs(doubles[i]) > float_max) {
+            CHECK(std::abs(clamped_floats[i]) == std::numeric_limits<float>::max());
+        } else {
+            CHECK(clamped_floats[i] == static_cast<float>(doubles[i]));
+        }
+    }
+
+    const std::string file_name("h5_fast_conversions.h5");
+    File file(file_name, File::Truncate);
+    std::vector<double> values = {1.5, -2.25, 3e38, 1e-3};
+    auto dataset = file.createDataSet("dset", DataSpace::From(values), BigEndianFloat());
+    dataset.write(values);
+
+    CHECK(dataset.explain<std::vector<double>>().conversion == ConversionPath::Hard);
+    auto read = dataset.read<std::vector<double>>();
+    for (size_t i = 0; i < values.size(); ++i) {
+        CHECK(read[i] == static_cast<double>(static_cast<float>(values[i])));
+    }
+
+    // HDF5 converts the pairs in software again.
+    unregister_fast_conversions();
+    CHECK(H5Tcompiler_conv(H5T_IEEE_F32BE, H5T_NATIVE_DOUBLE) == 0);
+    CHECK(dataset.explain<std::vector<double>>().conversion == ConversionPath::Soft);
+    CHECK(dataset.read<std::vector<double>>() == read);
+    CHECK(h5t_convert(cases[0].src, cases[0].dst, cases[0].input) == cases[0].expected);
+}
+
+namespace {
+class Float16Type: public DataType {
+  public:
+    Float16Type() {
+        _hid = details::create_float16_datatype();
+    }
+};
+
+H5T_conv_ret_t clamp_to_float16(H5T_conv_except_t except,
+                                hid_t /* src_id */,
+                                hid_t /* dst_id */,
+                                void* /* src */,
+                                void* dst,
+                                void* /* data */) {
+    uint16_t value = except == H5T_CONV_EXCEPT_RANGE_HI ? 0x7bff : 0xfbff;
+    std::memcpy(dst, &value, sizeof(value));
+    return H5T_CONV_HANDLED;
+}
+
+// The value of the half precision float with the bits `h`.
+float float16_value(uint16_t h) {
+    int exponent = (h >> 10) & 0x1f;
+    int mantissa = h & 0x3ff;
+    float sign = (h & 0x8000) != 0 ? -1.0f : 1.0f;
+    if (exponent == 0x1f) {
+        return mantissa == 0 ? sign * std::numeric_limits<float>::infinity()
+                             : std::numeric_limits<float>::quiet_NaN();
+    }
+    if (exponent == 0) {
+        return sign * std::ldexp(float(mantissa), -24);
+    }
+    return sign * std::ldexp(float(mantissa + 1024), exponent - 25);
+}
+}  // namespace
+
+TEST_CASE("HighFiveFastFloat16Conversions") {
+    // Unregister the conversions, even if a check fails. The built-in hard
+    // conversions they replaced aren't restored.
+    struct Unregister {
+        ~Unregister() {
+            unregister_fast_conversions();
+        }
+    } unregister;
+
+    Float16Type float16;
+
+    std::vector<uint16_t> halves(1 << 16);
+    std::iota(halves.begin(), halves.end(), uint16_t(0));
+
+    // Ties are rounded to even, finite values from 65520 on to infinity.
+    const float one = 1.0f;
+    std::vector<std::pair<float, uint16_t>> rounded = {
+        {0.0f, 0x0000},
+        {-0.0f, 0x8000},
+        {65504.0f, 0x7bff},
+        {std::nextafter(65520.0f, 0.0f), 0x7bff},
+        {65520.0f, 0x7c00},
+        {-65520.0f, 0xfc00},
+        {1e10f, 0x7c00},
+        {std::numeric_limits<float>::infinity(), 0x7c00},
+        {std::ldexp(one, -25), 0x0000},
+        {std::ldexp(3.0f, -25), 0x0002},
+        {std::ldexp(5.0f, -26), 0x0001},
+        {one + std::ldexp(one, -11), 0x3c00},
+        {one + std::ldexp(3.0f, -11), 0x3c02},
+    };
+
+    std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+    for (auto level: {SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level <= get_supported_simd_level()) {
+            levels.push_back(level);
+        }
+    }
+
+    for (auto level: levels) {
+        register_fast_conversions(level);
+        INFO("level " << static_cast<int>(level));
+        CHECK(H5Tcompiler_conv(float16.getId(), H5T_NATIVE_FLOAT) > 0);
+        CHECK(H5Tcompiler_conv(H5T_NATIVE_FLOAT, float16.getId()) > 0);
+
+        auto bytes = h5t_convert(float16.getId(), H5T_NATIVE_FLOAT, as_bytes(halves));
+        std::vector<float> floats(halves.size());
+        std::memcpy(floats.data(), bytes.data(), bytes.size());
+        size_t n_wrong = 0;
+        for (size_t i = 0; i < halves.size(); ++i) {
+            float expected = float16_value(halves[i]);
+            bool is_same = std::isnan(expected) ? std::isnan(floats[i]) : floats[i] == expected;
+            n_wrong += is_same ? 0u : 1u;
+        }
+        CHECK(n_wrong == 0);
+
+        // Every half, except NaNs, survives the round trip.
+        bytes = h5t_convert(H5T_NATIVE_FLOAT, float16.getId(), as_bytes(floats));
+        std::vector<uint16_t> round_trip(halves.size());
+        std::memcpy(round_trip.data(), bytes.data(), bytes.size());
+        n_wrong = 0;
+        for (size_t i = 0; i < halves.size(); ++i) {
+            n_wrong += std::isnan(floats[i]) || round_trip[i] == halves[i] ? 0u : 1u;
+        }
+        CHECK(n_wrong == 0);
+
+        for (const auto& r: rounded) {
+            auto half_bytes = h5t_convert(H5T_NATIVE_FLOAT,
+                                          float16.getId(),
+                                          as_bytes(std::vector<float>{r.first}));
+            uint16_t half;
+            std::memcpy(&half, half_bytes.data(), sizeof(half));
+            CHECK(half == r.second);
+        }
+    }
+
+    // The exception callback is called for values rounded to infinity.
+    auto dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_type_conv_cb(dxpl, clamp_to_float16, nullptr);
+    auto clamped = h5t_convert(H5T_NATIVE_FLOAT,
+                               float16.getId(),
+                               as_bytes(std::vector<float>{70000.0f, -1e10f, 1.0f}),
+                               dxpl);
+    H5Pclose(dxpl);
+    CHECK(clamped == as_bytes(std::vector<uint16_t>{0x7bff, 0xfbff, 0x3c00}));
+
+    const std::string file_name("h5_fast_float16.h5");
+    File file(file_name, File::Truncate);
+    std::vector<float> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = float(i) * 0.25f - 100.0f;
+    }
+    auto dataset = file.createDataSet("dset", DataSpace::From(values), float16);
+    dataset.write(values);
+
+    auto read = dataset.read<std::vector<float>>();
+    auto slab = dataset.select({10}, {100}).read<std::vector<float>>();
+    CHECK(read == values);
+    CHECK(slab == std::vector<float>(values.begin() + 10, values.begin() + 110));
+}
+
+namespace {
+H5T_conv_ret_t clamp_to_bfloat16(H5T_conv_except_t except,
+                                 hid_t /* src_id */,
+                                 hid_t /* dst_id */,
+                                 void* /* src */,
+                                 void* dst,
+                                 void* /* data */) {
+    uint16_t value = except == H5T_CONV_EXCEPT_RANGE_HI ? 0x7f7f : 0xff7f;
+    std::memcpy(dst, &value, sizeof(value));
+    return H5T_CONV_HANDLED;
+}
+
+uint32_t float_bits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float float_from_bits(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+}  // namespace
+
+TEST_CASE("HighFiveBFloat16") {
+    // Unregister the conversions, even if a check fails. The built-in hard
+    // conversions they replaced aren't restored.
+    struct Unregister {
+        ~Unregister() {
+            unregister_fast_conversions();
+        }
+    } unregister;
+
+    // Ties are rounded to even, subnormal values are kept and NaNs stay NaN.
+    const float one = 1.0f;
+    std::vector<std::pair<float, uint16_t>> rounded = {
+        {0.0f, 0x0000},
+        {-0.0f, 0x8000},
+        {one, 0x3f80},
+        {-2.0f, 0xc000},
+        {one + std::ldexp(one, -8), 0x3f80},
+        {one + std::ldexp(3.0f, -8), 0x3f82},
+        {one + std::ldexp(one, -8) + std::ldexp(one, -20), 0x3f81},
+        {std::numeric_limits<float>::max(), 0x7f80},
+        {-std::numeric_limits<float>::max(), 0xff80},
+        {float_from_bits(0x7f7f7fff), 0x7f7f},
+        {std::numeric_limits<float>::infinity(), 0x7f80},
+        {float_from_bits(0x00010000), 0x0001},
+        {float_from_bits(0x00008000), 0x0000},
+        {float_from_bits(0x00018000), 0x0002},
+        {float_from_bits(0x7f800001), 0x7fc0},
+        {float_from_bits(0xffc00000), 0xffc0},
+    };
+    for (const auto& r: rounded) {
+        INFO("value " << r.first);
+        CHECK(bfloat16_t(r.first).getBits() == r.second);
+    }
+    CHECK(float(bfloat16_t::fromBits(0x4049)) == 3.140625f);
+    CHECK(std::isnan(float(bfloat16_t(std::numeric_limits<float>::quiet_NaN()))));
+
+    DataType bfloat16 = create_datatype<bfloat16_t>();
+    CHECK(bfloat16.getClass() == DataTypeClass::Float);
+    CHECK(bfloat16.getSize() == 2);
+
+    std::vector<uint16_t> all_bits(1 << 16);
+    std::iota(all_bits.begin(), all_bits.end(), uint16_t(0));
+
+    // Every `bfloat16_t` with various lower halves, including ties.
+    std::vector<float> floats;
+    for (uint32_t bits: all_bits) {
+        for (uint32_t lower: {0x0000u, 0x0001u, 0x7fffu, 0x8000u, 0x8001u, 0xffffu}) {
+            floats.push_back(float_from_bits(bits << 16 | lower));
+        }
+    }
+
+    std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+    for (auto level: {SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level <= get_supported_simd_level()) {
+            levels.push_back(level);
+        }
+    }
+
+    for (auto level: levels) {
+        register_fast_conversions(level);
+        INFO("level " << static_cast<int>(level));
+        CHECK(H5Tcompiler_conv(bfloat16.getId(), H5T_NATIVE_FLOAT) > 0);
+        CHECK(H5Tcompiler_conv(H5T_NATIVE_FLOAT, bfloat16.getId()) > 0);
+
+        // Widening is exact, including NaN payloads.
+        auto bytes = h5t_convert(bfloat16.getId(), H5T_NATIVE_FLOAT, as_bytes(all_bits));
+        std::vector<float> widened(all_bits.size());
+        std::memcpy(widened.data(), bytes.data(), bytes.size());
+        size_t n_wrong = 0;
+        for (size_t i = 0; i < all_bits.size(); ++i) {
+            n_wrong += float_bits(widened[i]) == uint32_t(all_bits[i]) << 16 ? 0u : 1u;
+        }
+        CHECK(n_wrong == 0);
+
+        bytes = h5t_convert(H5T_NATIVE_FLOAT, bfloat16.getId(), as_bytes(floats));
+        std::vector<uint16_t> narrowed(floats.size());
+        std::memcpy(narrowed.data(), bytes.data(), bytes.size());
+        n_wrong = 0;
+        for (size_t i = 0; i < floats.size(); ++i) {
+            n_wrong += narrowed[i] == bfloat16_t(floats[i]).getBits() ? 0u : 1u;
+        }
+        CHECK(n_wrong == 0);
+    }
+
+    // The exception callback is called for finite values rounded to infinity.
+    auto dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_type_conv_cb(dxpl, clamp_to_bfloat16, nullptr);
+    auto max = std::numeric_limits<float>::max();
+    auto clamped = h5t_convert(H5T_NATIVE_FLOAT,
+                               bfloat16.getId(),
+                               as_bytes(std::vector<float>{max, -max, one}),
+                               dxpl);
+    H5Pclose(dxpl);
+    CHECK(clamped == as_bytes(std::vector<uint16_t>{0x7f7f, 0xff7f, 0x3f80}));
+
+    const std::string file_name("h5_bfloat16.h5");
+    File file(file_name, File::Truncate);
+    std::vector<bfloat16_t> values;
+    for (size_t i = 0; i < 1000; ++i) {
+        values.emplace_back(float(i) * 0.25f - 100.0f);
+    }
+    auto dataset = file.createDataSet("dset", values);
+    CHECK(dataset.getDataType() == bfloat16);
+    CHECK(dataset.getStorageSize() == values.size() * 2);
+
+    auto read_values = dataset.read<std::vector<bfloat16_t>>();
+    CHECK(std::equal(values.begin(),
+                     values.end(),
+                     read_values.begin(),
+                     [](bfloat16_t a, bfloat16_t b) { return a.getBits() == b.getBits(); }));
+
+    auto read = dataset.read<std::vector<float>>();
+    auto slab = dataset.select({10}, {100}).read<std::vector<float>>();
+    std::vector<float> expected(values.begin(), values.end());
+    CHECK(read == expected);
+    CHECK(slab == std::vector<float>(expected.begin() + 10, expected.begin() + 110));
+}
+
+namespace {
+// The sizes of the buffers passed to `H5Dread`, while `op` runs.
+std::vector<size_t> read_bytes(const std::function<void()>& op) {
+    std::vector<size_t> bytes;
+    register_instrumentation_callback([&bytes](const InstrumentationRecord& record) {
+        if (std::strcmp(record.function, "h5d_read") == 0) {
+            bytes.push_back(record.bytes);
+        }
+    });
+    struct Unregister {
+        ~Unregister() {
+            register_instrumentation_callback(nullptr);
+        }
+    } unregister;
+
+    op();
+    return bytes;
+}
+}  // namespace
+
+TEST_CASE("Direct read of half precision floats") {
+    register_fast_conversions();
+    // Unregister the conversions, even if a check fails. The built-in hard
+    // conversions they replaced aren't restored.
+    struct Unregister {
+        ~Unregister() {
+            unregister_fast_conversions();
+        }
+    } unregister;
+
+    const std::string file_name("h5_direct_float16.h5");
+    File file(file_name, File::Truncate);
+    std::vector<float> values(1000);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = float(i) * 0.25f - 100.0f;
+    }
+    Float16Type float16;
+    auto dataset = file.createDataSet("dset", DataSpace::From(values), float16);
+    dataset.write(values);
+
+    // Half precision is read directly, without an HDF5 conversion.
+    auto bytes = read_bytes([&]() {
+        CHECK(dataset.read<std::vector<float>>() == values);
+        CHECK(dataset.select({10}, {100}).read<std::vector<float>>() ==
+              std::vector<float>(values.begin() + 10, values.begin() + 110));
+    });
+    CHECK(bytes == std::vector<size_t>{values.size() * 2, 100 * 2});
+
+    // Raw reads use the registered conversion.
+    std::vector<float> raw(values.size());
+    bytes = read_bytes([&]() { dataset.read_raw(raw.data()); });
+    CHECK(raw == values);
+    CHECK(bytes == std::vector<size_t>{values.size() * sizeof(float)});
+}
+
+TEST_CASE("Direct read of bfloat16") {
+    register_fast_conversions();
+    // Unregister the conversions, even if a check fails. The built-in hard
+    // conversions they replaced aren't restored.
+    struct Unregister {
+        ~Unregister() {
+            unregister_fast_conversions();
+        }
+    } unregister;
+
+    const std::string file_name("h5_direct_bfloat16.h5");
+    File file(file_name, File::Truncate);
+    std::vector<bfloat16_t> values;
+    for (size_t i = 0; i < 1000; ++i) {
+        values.emplace_back(float(i) * 0.25f - 100.0f);
+    }
+    auto dataset = file.createDataSet("dset", values);
+
+    // `bfloat16_t` is read into `float` directly, without an HDF5 conversion.
+    std::vector<float> expected(values.begin(), values.end());
+    auto bytes = read_bytes([&]() {
+        CHECK(dataset.read<std::vector<float>>() == expected);
+        CHECK(dataset.select({10}, {100}).read<std::vector<float>>() ==
+              std::vector<float>(expected.begin() + 10, expected.begin() + 110));
+    });
+    CHECK(bytes == std::vector<size_t>{values.size() * 2, 100 * 2});
+}
@@ -0,0 +1,378 @@
+/*
+ *  Copyright (c), 2024, Blue Brain Project - EPFL (CH)
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+// Tests which need the library to be compiled with instrumentation. Every
+// other test is compiled without it.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#define HIGHFIVE_COUNT_REFERENCE_OPERATIONS
+#define HIGHFIVE_ENABLE_INSTRUMENTATION
+#include <highfive/highfive.hpp>
+
+using namespace HighFive;
+
+TEST_CASE("Test reference count traffic") {
+    const std::string file_name("h5_ref_count_traffic.h5");
+    File file(file_name, File::Truncate);
+
+    std::vector<double> values(100, 1.0);
+    auto dataset = file.createDataSet("dset", values);
+    auto attribute = dataset.createAttribute("attr", values);
+    auto selection = dataset.select({10}, {20});
+
+    // Counts the calls to `H5Iinc_ref` and `H5Idec_ref` made by `op`.
+    auto count = [](const std::function<void()>& op) {
+        auto before = detail::reference_operation_count().load();
+        op();
+        return detail::reference_operation_count().load() - before;
+    };
+
+    std::vector<double> buffer;
+    auto n_dataset_read = count([&]() { dataset.read(buffer); });
+    auto n_dataset_write = count([&]() { dataset.write(values); });
+    auto n_selection_read = count([&]() { selection.read(buffer); });
+    auto n_selection_write = count([&]() { selection.write(buffer); });
+    auto n_attribute_read = count([&]() { attribute.read(buffer); });
+    auto n_attribute_write = count([&]() { attribute.write(values); });
+    auto n_squeeze = count([&]() { selection.squeezeMemSpace({}); });
+    auto n_reshape = count([&]() { selection.reshapeMemSpace({2, 10}); });
+
+    // Each handle created by the operation must be released once, e.g. the
+    // datatype of the dataset. Beyond that, no handle is copied.
+    CHECK(n_dataset_read <= 3);
+    CHECK(n_dataset_write <= 3);
+    CHECK(n_selection_read <= 2);
+    CHECK(n_selection_write <= 2);
+    CHECK(n_attribute_read <= 3);
+    CHECK(n_attribute_write <= 3);
+
+    // The selection shares the file space and the dataset.
+    CHECK(n_squeeze <= 5);
+    CHECK(n_reshape <= 5);
+
+    // Moving doesn't touch the reference count, assigning releases the
+    // previous handle.
+    auto space = DataSpace({3});
+    CHECK(count([&]() { auto moved = std::move(dataset); dataset = std::move(moved); }) == 0);
+    CHECK(count([&]() { space = DataSpace({4}); }) == 1);
+    CHECK(count([&]() { auto copy = dataset; }) == 2);
+}
+
+TEST_CASE("HighFiveInstrumentation") {
+    const std::string file_name("h5_instrumentation.h5");
+    File file(file_name, File::Truncate);
+    std::vector<double> values(100, 1.0);
+    auto dataset = file.createDataSet("group/dset", values);
+    auto attribute = dataset.createAttribute("attr", values);
+
+    CallStatistics stats;
+    std::vector<std::string> functions;
+    register_instrumentation_callback([&](const InstrumentationRecord& record) {
+        stats.record(record);
+        functions.emplace_back(record.function);
+
+        // Calls made by the callback aren't recorded.
+        if (record.object == dataset.getId()) {
+            dataset.getPath();
+        }
+    });
+
+    // Stop recording, even if a check fails.
+    struct Unregister {
+        ~Unregister() {
+            register_instrumentation_callback(nullptr);
+        }
+    } unregister;
+
+    dataset.write(values);
+    dataset.select({10}, {20}).read<std::vector<double>>();
+    attribute.read<std::vector<double>>();
+
+    auto by_function = stats.byFunction();
+    CHECK(by_function["h5d_write"].calls == 1);
+    CHECK(by_function["h5d_write"].bytes == 100 * sizeof(double));
+    CHECK(by_function["h5d_read"].calls == 1);
+    CHECK(by_function["h5d_read"].bytes == 20 * sizeof(double));
+    CHECK(by_function["h5a_read"].bytes == 100 * sizeof(double));
+    CHECK(by_function.count("h5i_get_name") == 0);
+
+    auto by_path = stats.byPath();
+    REQUIRE(by_path.count("/group/dset") == 1);
+    CHECK(by_path["/group/dset"].bytes == 120 * sizeof(double));
+    CHECK(by_path["/group/dset"].calls >= 2);
+
+    size_t n_calls = 0;
+    for (const auto& entry: by_function) {
+        n_calls += entry.second.calls;
+    }
+    CHECK(n_calls == functions.size());
+
+    register_instrumentation_callback(nullptr);
+    dataset.write(values);
+    CHECK(stats.byFunction()["h5d_write"].calls == 1);
+}
+
+TEST_CASE("Instrumentation records failed calls") {
+    const std::string file_name("h5_instrumentation_failures.h5");
+    File file(file_name, File::Truncate);
+
+    std::vector<std::string> functions;
+    register_instrumentation_callback([&functions](const InstrumentationRecord& record) {
+        functions.emplace_back(record.function);
+    });
+    struct Unregister {
+        ~Unregister() {
+            register_instrumentation_callback(nullptr);
+        }
+    } unregister;
+
+    SilenceHDF5 silencer;
+    CHECK_THROWS_AS(file.getDataSet("missing"), DataSetException);
+    CHECK(std::count(functions.begin(), functions.end(), "h5d_open2") == 1);
+}
+
+TEST_CASE("Instrumentation callback replaced concurrently") {
+    const std::string file_name("h5_instrumentation_threads.h5");
+    File file(file_name, File::Truncate);
+    auto dataset = file.createDataSet("dset", std::vector<double>(100, 1.0));
+
+    std::atomic<size_t> n_records{0};
+    std::atomic<bool> done{false};
+
+    // HDF5 isn't necessarily thread-safe, only the callback is replaced
+    // concurrently.
+    std::thread reader([&]() {
+        while (!done) {
+            get_global_instrumentation().record(InstrumentationRecord{
+                "h5d_read", dataset.getId(), 0, std::chrono::nanoseconds(0), {}, 0});
+        }
+    });
+
+    for (int i = 0; i < 1000; ++i) {
+        register_instrumentation_callback(
+            [&n_records](const InstrumentationRecord&) { ++n_records; });
+        register_instrumentation_callback(nullptr);
+    }
+    done = true;
+    reader.join();
+
+    auto before = n_records.load();
+    get_global_instrumentation().record(InstrumentationRecord{
+        "h5d_read", dataset.getId(), 0, std::chrono::nanoseconds(0), {}, 0});
+    CHECK(n_records == before);
+}
+
+TEST_CASE("Sparse read falls back to a regular read") {
+    const std::string file_name("h5_sparse_read_fallback.h5");
+    File file(file_name, File::Truncate);
+
+    const int fill_value = -1;
+    auto dcpl = DataSetCreateProps{};
+    dcpl.add(Chunking(std::vector<hsize_t>{1}));
+    H5Pset_fill_value(dcpl.getId(), H5T_NATIVE_INT, &fill_value);
+    auto dataset = file.createDataSet("dset", DataSpace({10000}), create_datatype<int>(), dcpl);
+    dataset.select({0}, {5000}).write(std::vector<int>(5000, 3));
+
+    std::vector<std::string> functions;
+    register_instrumentation_callback([&functions](const InstrumentationRecord& record) {
+        functions.emplace_back(record.function);
+    });
+    struct Unregister {
+        ~Unregister() {
+            register_instrumentation_callback(nullptr);
+        }
+    } unregister;
+
+    auto array = dataset.readSparse<std::vector<int>>();
+    CHECK(array.front() == 3);
+    CHECK(array.back() == fill_value);
+    CHECK(std::count(functions.begin(), functions.end(), "h5d_read") == 1);
+
+    // Without `H5Dchunk_iter` the chunks aren't listed, neither is the buffer
+    // filled.
+    auto n_fill = std::count(functions.begin(), functions.end(), "h5p_get_fill_value");
+#if HIGHFIVE_HAS_CHUNK_ITER
+    CHECK(n_fill == 1);
+#else
+    CHECK(n_fill == 0);
+#endif
+}
+
+TEST_CASE("HighFiveConverterStatistics") {
+    const std::string file_name("h5_converter_statistics.h5");
+    File file(file_name, File::Truncate);
+
+    std::vector<double> values(100, 1.0);
+    std::vector<std::vector<double>> matrix(10, std::vector<double>(5, 2.0));
+    std::vector<std::string> strings{"a", "bc", "def"};
+
+    auto dataset = file.createDataSet<double>("values", DataSpace::From(values));
+    auto matrix_dataset = file.createDataSet<double>("matrix", DataSpace::From(matrix));
+    auto strings_dataset = file.createDataSet("strings", strings);
+
+    reset_converter_statistics();
+    reset_thread_converter_statistics();
+
+    dataset.write(values);
+    matrix_dataset.write(matrix);
+    matrix_dataset.read<std::vector<std::vector<double>>>();
+    strings_dataset.read<std::vector<std::string>>();
+
+    auto stats = get_thread_converter_statistics();
+    CHECK(stats.shallow_copies == 1);
+    CHECK(stats.deep_copies == 2);
+    CHECK(stats.string_copies == 1);
+    CHECK(stats.scratch_bytes == 2 * 50 * sizeof(double) + 3 * sizeof(char*));
+
+    auto global = get_converter_statistics();
+    CHECK(global.deep_copies == stats.deep_copies);
+    CHECK(global.scratch_bytes == stats.scratch_bytes);
+
+    // Other threads only contribute to the global counters.
+    std::thread([&matrix_dataset]() {
+        matrix_dataset.read<std::vector<std::vector<double>>>();
+        CHECK(get_thread_converter_statistics().deep_copies == 1);
+    }).join();
+    CHECK(get_thread_converter_statistics().deep_copies == 2);
+    CHECK(get_converter_statistics().deep_copies == 3);
+
+    reset_converter_statistics();
+    CHECK(get_converter_statistics().deep_copies == 0);
+    CHECK(get_converter_statistics().serialize_duration.count() == 0);
+    CHECK(get_thread_converter_statistics().deep_copies == 2);
+
+    reset_thread_converter_statistics();
+    CHECK(get_thread_converter_statistics().scratch_bytes == 0);
+}
+
+TEST_CASE("Lookups of missing objects don't fail") {
+    const std::string file_name("h5_try_get_calls.h5");
+    File file(file_name, File::Truncate);
+    auto dataset = file.createDataSet("a/b/x", 42);
+    dataset.createAttribute("attr", 42);
+
+    std::vector<std::string> functions;
+    register_instrumentation_callback([&functions](const InstrumentationRecord& record) {
+        functions.emplace_back(record.function);
+    });
+    struct Unregister {
+        ~Unregister() {
+            register_instrumentation_callback(nullptr);
+        }
+    } unregister;
+
+    CHECK(!file.tryGetDataSet("a/b/z"));
+    CHECK(!file.tryGetDataSet("a/missing/x"));
+    CHECK(std::count(functions.begin(), functions.end(), "h5d_open2") == 0);
+
+    // Missing attributes aren't opened.
+    functions.clear();
+    CHECK(!dataset.tryGetAttribute("missing"));
+    CHECK(std::count(functions.begin(), functions.end(), "h5a_exists") == 1);
+    CHECK(std::count(functions.begin(), functions.end(), "h5a_open") == 0);
+
+    functions.clear();
+    CHECK(dataset.tryGetAttribute("attr"));
+    CHECK(std::count(functions.begin(), functions.end(), "h5a_open") == 1);
+}
+
+TEST_CASE("HighFiveChromeTrace") {
+    const std::string file_name("h5_chrome_trace.h5");
+    File file(file_name, File::Truncate);
+
+    ChromeTrace trace(3);
+    register_instrumentation_callback(
+        [&trace](const InstrumentationRecord& record) { trace.record(record); });
+    struct Unregister {
+        ~Unregister() {
+            register_instrumentation_callback(nullptr);
+        }
+    } unregister;
+
+    std::vector<std::vector<double>> values(4, std::vector<double>(5, 1.0));
+    auto dataset = file.createDataSet("group/dset", values);
+    dataset.read<std::vector<std::vector<double>>>();
+    file.flush();
+    register_instrumentation_callback(nullptr);
+
+    // create, serialize, write, read, unserialize and flush.
+    CHECK(trace.size() == 6);
+
+    std::stringstream ss;
+    trace.write(ss);
+    auto json = ss.str();
+    CHECK(json.find("{\"traceEvents\":[") == 0);
+    CHECK(json.find("\"name\":\"h5d_create2\",\"cat\":\"create\"") != std::string::npos);
+    CHECK(json.find("\"cat\":\"convert\"") != std::string::npos);
+    CHECK(json.find("\"cat\":\"flush\"") != std::string::npos);
+    CHECK(json.find("\"pid\":3") != std::string::npos);
+    CHECK(json.find("\"path\":\"/group/dset\",\"elements\":20,\"bytes\":160") !=
+          std::string::npos);
+    CHECK(json.find("h5d_get_space") == std::string::npos);
+
+    // The creation is attributed to the dataset, not to its parent.
+    auto create = json.find("\"name\":\"h5d_create2\"");
+    auto create_end = json.find('\n', create);
+    CHECK(json.substr(create, create_end - create).find("\"path\":\"/group/dset\"") !=
+          std::string::npos);
+
+    // Timestamps are in microseconds since the Unix epoch.
+    auto ts = json.find("\"ts\":") + 5;
+    auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+                   .count();
+    CHECK(std::abs(std::stoll(json.substr(ts, json.find('.', ts) - ts)) - now) < 60000000);
+
+    trace.clear();
+    CHECK(trace.size() == 0);
+}
+
+TEST_CASE("Variable length reads from an arena") {
+    const std::string file_name("h5_vlen_arena_reclaim.h5");
+    File file(file_name, File::Truncate);
+    std::vector<std::string> strings(1000);
+    for (size_t i = 0; i < strings.size(); ++i) {
+        strings[i] = std::string(i % 50, char('a' + i % 26));
+    }
+    auto dataset = file.createDataSet("strings", strings);
+
+    // The strings aren't reclaimed one by one.
+    std::vector<std::string> functions;
+    register_instrumentation_callback([&functions](const InstrumentationRecord& record) {
+        functions.emplace_back(record.function);
+    });
+    struct Unregister {
+        ~Unregister() {
+            register_instrumentation_callback(nullptr);
+        }
+    } unregister;
+
+    CHECK(dataset.read<std::vector<std::string>>() == strings);
+    CHECK(dataset.select({10}, {20}).read<std::vector<std::string>>() ==
+          std::vector<std::string>(strings.begin() + 10, strings.begin() + 30));
+    DataTransferProps auto_buffers;
+    auto_buffers.add(AutoTransferBuffers());
+    CHECK(dataset.read<std::vector<std::string>>(auto_buffers) == strings);
+    register_instrumentation_callback(nullptr);
+    CHECK(std::none_of(functions.begin(), functions.end(), [](const std::string& f) {
+        return f.find("reclaim") != std::string::npos;
+    }));
+}